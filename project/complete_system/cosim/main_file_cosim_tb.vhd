@@ -0,0 +1,152 @@
+library ieee;
+use ieee.std_logic_1164.all;
+use ieee.numeric_std.all;
+
+library vunit_lib;
+context vunit_lib.vunit_context;
+
+library tb;
+
+library src;
+
+-- Runs main_file until a host, typically uart_master, has connected to the cosimulation pseudo terminal and left again.
+-- With serial_bypass the host bytes are handed to the bus master directly, otherwise they are serialized at baud_rate.
+entity main_file_cosim_tb is
+    generic (
+        runner_cfg : string;
+        serial_bypass : boolean := true;
+        baud_rate : positive := 2000000);
+end entity;
+
+architecture tb of main_file_cosim_tb is
+    constant clk_period : time := 10 ns;
+
+    signal clk : std_logic := '0';
+    signal rx : std_logic := '1';
+    signal tx : std_logic;
+    -- SPI mem
+    signal cs_n : std_logic_vector(2 downto 0);
+    signal so_sio1 : std_logic;
+    signal sio2 : std_logic;
+    signal hold_n_sio3 : std_logic;
+    signal sck : std_logic;
+    signal si_sio0 : std_logic;
+    -- UART slave
+    signal slv_tx : std_logic;
+    signal slv_rx : std_logic := '1';
+
+    signal rst : std_logic := '0';
+
+    signal host_byte : std_logic_vector(7 downto 0);
+    signal host_byte_valid : boolean;
+    signal host_byte_ready : boolean;
+    signal device_byte : std_logic_vector(7 downto 0);
+    signal device_byte_valid : boolean;
+    signal host_disconnected : boolean;
+begin
+    clk <= not clk after (clk_period/2);
+    process
+    begin
+        test_runner_setup(runner, runner_cfg);
+        while test_suite loop
+            if run("Serve host") then
+                wait until host_disconnected;
+            end if;
+        end loop;
+        wait until rising_edge(clk) or falling_edge(clk);
+        test_runner_cleanup(runner);
+        wait;
+    end process;
+
+    test_runner_watchdog(runner, 10 sec);
+
+    mem_pcb : entity tb.triple_M23LC1024
+    port map (
+        cs_n => cs_n,
+        so_sio1 => so_sio1,
+        sio2 => sio2,
+        hold_n_sio3 => hold_n_sio3,
+        sck => sck,
+        si_sio0 => si_sio0
+    );
+
+    main_file : entity src.main_file
+    generic map (
+        clk_period => clk_period,
+        baud_rate => baud_rate,
+        master_serial_bypass => serial_bypass
+    ) port map (
+        JA_gpio(0) => si_sio0,
+        JA_gpio(1) => so_sio1,
+        JA_gpio(2) => sio2,
+        JA_gpio(3) => hold_n_sio3,
+        JB_gpio(3 downto 1) => cs_n,
+        JB_gpio(0) => sck,
+        clk => clk,
+        global_reset => rst,
+        master_rx => rx,
+        master_tx => tx,
+        slave_rx => slv_rx,
+        slave_tx => slv_tx,
+        master_bypass_rx_byte => host_byte,
+        master_bypass_rx_valid => host_byte_valid,
+        master_bypass_rx_ready => host_byte_ready,
+        master_bypass_tx_byte => device_byte,
+        master_bypass_tx_valid => device_byte_valid
+    );
+
+    serial_gen : if not serial_bypass generate
+        signal host_tx_busy : boolean;
+        signal host_rx_byte : std_logic_vector(7 downto 0);
+        signal host_rx_valid : boolean;
+    begin
+        host_tx : entity src.uart_bus_master_tx
+        generic map (
+            clk_period => clk_period,
+            baud_rate => baud_rate
+        ) port map (
+            clk => clk,
+            rst => '0',
+            tx => rx,
+            transmit_byte => host_byte,
+            data_ready => host_byte_valid,
+            busy => host_tx_busy
+        );
+
+        host_rx : entity src.uart_bus_master_rx
+        generic map (
+            clk_period => clk_period,
+            baud_rate => baud_rate
+        ) port map (
+            clk => clk,
+            rst => '0',
+            rx => tx,
+            receive_byte => host_rx_byte,
+            data_ready => host_rx_valid
+        );
+
+        bridge : entity tb.uart_cosim_bridge
+        port map (
+            clk => clk,
+            host_byte => host_byte,
+            host_byte_valid => host_byte_valid,
+            host_byte_ready => not host_tx_busy,
+            device_byte => host_rx_byte,
+            device_byte_valid => host_rx_valid,
+            host_disconnected => host_disconnected
+        );
+    end generate;
+
+    bypass_gen : if serial_bypass generate
+        bridge : entity tb.uart_cosim_bridge
+        port map (
+            clk => clk,
+            host_byte => host_byte,
+            host_byte_valid => host_byte_valid,
+            host_byte_ready => host_byte_ready,
+            device_byte => device_byte,
+            device_byte_valid => device_byte_valid,
+            host_disconnected => host_disconnected
+        );
+    end generate;
+end architecture;
@@ -0,0 +1,100 @@
+// VHPIDIRECT side of uart_cosim_pkg. Exposes the command UART of a simulated main_file as a pseudo terminal, so that
+// uart_master can talk to the RTL exactly as it would talk to /dev/ttyUSB1.
+#define _GNU_SOURCE
+#include <errno.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <termios.h>
+#include <unistd.h>
+
+// Keep in sync with uart_cosim_pkg.vhd
+static const int UART_COSIM_NO_DATA = -1;
+static const int UART_COSIM_HANGUP = -2;
+
+static int masterFd = -1;
+static int hostConnected = 0;
+
+static int setSlaveRaw(const char* slaveName) {
+    int slaveFd = open(slaveName, O_RDWR | O_NOCTTY);
+    if (slaveFd == -1) {
+        perror("uart_cosim: open slave");
+        return -1;
+    }
+    struct termios tty;
+    if (tcgetattr(slaveFd, &tty) == -1) {
+        perror("uart_cosim: tcgetattr");
+        close(slaveFd);
+        return -1;
+    }
+    cfmakeraw(&tty);
+    if (tcsetattr(slaveFd, TCSANOW, &tty) == -1) {
+        perror("uart_cosim: tcsetattr");
+        close(slaveFd);
+        return -1;
+    }
+    close(slaveFd);
+    return 0;
+}
+
+int uart_cosim_open(void) {
+    masterFd = posix_openpt(O_RDWR | O_NOCTTY | O_NONBLOCK);
+    if (masterFd == -1) {
+        perror("uart_cosim: posix_openpt");
+        return -1;
+    }
+    if (grantpt(masterFd) == -1 || unlockpt(masterFd) == -1) {
+        perror("uart_cosim: grantpt/unlockpt");
+        return -1;
+    }
+    const char* slaveName = ptsname(masterFd);
+    if (slaveName == NULL) {
+        perror("uart_cosim: ptsname");
+        return -1;
+    }
+    if (setSlaveRaw(slaveName) == -1) {
+        return -1;
+    }
+    const char* linkPath = getenv("UART_COSIM_PTY");
+    if (linkPath != NULL) {
+        unlink(linkPath);
+        if (symlink(slaveName, linkPath) == -1) {
+            perror("uart_cosim: symlink");
+            return -1;
+        }
+        printf("uart_cosim: %s -> %s\n", linkPath, slaveName);
+    } else {
+        printf("uart_cosim: %s\n", slaveName);
+    }
+    fflush(stdout);
+    return 0;
+}
+
+int uart_cosim_read(void) {
+    unsigned char byte;
+    ssize_t retVal = read(masterFd, &byte, 1);
+    if (retVal == 1) {
+        hostConnected = 1;
+        return byte;
+    }
+    // Reading the master returns EIO as long as nobody has the slave open, which is both the case before the host
+    // connects and after it has left. Any other outcome means the slave is open, even if nothing was sent yet.
+    if (retVal == -1 && errno == EIO) {
+        return hostConnected ? UART_COSIM_HANGUP : UART_COSIM_NO_DATA;
+    }
+    hostConnected = 1;
+    return UART_COSIM_NO_DATA;
+}
+
+void uart_cosim_write(int data) {
+    unsigned char byte = (unsigned char)data;
+    while (1) {
+        ssize_t retVal = write(masterFd, &byte, 1);
+        if (retVal == 1 || (retVal == -1 && errno != EAGAIN && errno != EINTR)) {
+            return;
+        }
+        struct pollfd pfd = {.fd = masterFd, .events = POLLOUT};
+        poll(&pfd, 1, -1);
+    }
+}
@@ -0,0 +1,59 @@
+library ieee;
+use ieee.std_logic_1164.all;
+use ieee.numeric_std.all;
+
+library tb;
+use tb.uart_cosim_pkg.all;
+
+entity uart_cosim_bridge is
+    generic (
+        -- Every poll of the host is a syscall, so do not poll every cycle.
+        poll_interval : positive range 4 to positive'high := 16
+    );
+    port (
+        clk : in std_logic;
+
+        host_byte : out std_logic_vector(7 downto 0);
+        host_byte_valid : out boolean;
+        host_byte_ready : in boolean;
+
+        device_byte : in std_logic_vector(7 downto 0);
+        device_byte_valid : in boolean;
+
+        host_disconnected : out boolean
+    );
+end entity;
+
+architecture behavioral of uart_cosim_bridge is
+begin
+    process(clk)
+        variable initialized : boolean := false;
+        variable poll_counter : natural range 0 to poll_interval - 1 := 0;
+        variable received : integer;
+        variable disconnected : boolean := false;
+    begin
+        if rising_edge(clk) then
+            host_byte_valid <= false;
+            if not initialized then
+                assert uart_cosim_open = 0 report "Failed to create the cosimulation pseudo terminal" severity failure;
+                initialized := true;
+            end if;
+            if device_byte_valid then
+                uart_cosim_write(to_integer(unsigned(device_byte)));
+            end if;
+            if poll_counter /= 0 then
+                poll_counter := poll_counter - 1;
+            elsif host_byte_ready and not disconnected then
+                poll_counter := poll_interval - 1;
+                received := uart_cosim_read;
+                if received = UART_COSIM_HANGUP then
+                    disconnected := true;
+                elsif received /= UART_COSIM_NO_DATA then
+                    host_byte <= std_logic_vector(to_unsigned(received, host_byte'length));
+                    host_byte_valid <= true;
+                end if;
+            end if;
+        end if;
+        host_disconnected <= disconnected;
+    end process;
+end architecture;
@@ -0,0 +1,40 @@
+library ieee;
+use ieee.std_logic_1164.all;
+
+-- Foreign functions implemented in uart_cosim_bridge.c. This requires a GHDL build with the LLVM or GCC backend, the
+-- C file is linked in during elaboration.
+package uart_cosim_pkg is
+    constant UART_COSIM_NO_DATA : integer := -1;
+    constant UART_COSIM_HANGUP : integer := -2;
+
+    -- Creates the pseudo terminal. If the environment variable UART_COSIM_PTY is set, a symlink to the terminal is
+    -- created at that path. Returns 0 on success.
+    impure function uart_cosim_open return integer;
+    attribute foreign of uart_cosim_open : function is "VHPIDIRECT uart_cosim_open";
+
+    -- Returns the next byte from the host, UART_COSIM_NO_DATA or UART_COSIM_HANGUP. Never blocks.
+    impure function uart_cosim_read return integer;
+    attribute foreign of uart_cosim_read : function is "VHPIDIRECT uart_cosim_read";
+
+    procedure uart_cosim_write(data : integer);
+    attribute foreign of uart_cosim_write : procedure is "VHPIDIRECT uart_cosim_write";
+end package;
+
+package body uart_cosim_pkg is
+    impure function uart_cosim_open return integer is
+    begin
+        report "VHPIDIRECT uart_cosim_open" severity failure;
+        return -1;
+    end function;
+
+    impure function uart_cosim_read return integer is
+    begin
+        report "VHPIDIRECT uart_cosim_read" severity failure;
+        return UART_COSIM_NO_DATA;
+    end function;
+
+    procedure uart_cosim_write(data : integer) is
+    begin
+        report "VHPIDIRECT uart_cosim_write" severity failure;
+    end procedure;
+end package body;
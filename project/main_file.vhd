@@ -8,7 +8,9 @@ use work.bus_pkg.all;
 entity main_file is
     generic (
         clk_period : time;
-        baud_rate : positive := 115200
+        baud_rate : positive := 115200;
+        -- Simulation only, see uart_bus_master.
+        master_serial_bypass : boolean := false
     );
     port (
         JA_gpio : inout  STD_LOGIC_VECTOR (3 downto 0);
@@ -20,7 +22,13 @@ entity main_file is
         master_tx : out std_logic;
 
         slave_rx : in std_logic;
-        slave_tx : out std_logic
+        slave_tx : out std_logic;
+
+        master_bypass_rx_byte : in std_logic_vector(7 downto 0) := (others => '0');
+        master_bypass_rx_valid : in boolean := false;
+        master_bypass_rx_ready : out boolean;
+        master_bypass_tx_byte : out std_logic_vector(7 downto 0);
+        master_bypass_tx_valid : out boolean
     );
 end main_file;
 
@@ -32,7 +40,7 @@ architecture Behavioral of main_file is
     constant address_map : addr_range_and_mapping_array := (
         address_range_and_map(
             low => std_logic_vector(to_unsigned(16#1000#, bus_address_type'length)),
-            high => std_logic_vector(to_unsigned(16#100c# - 1, bus_address_type'length)),
+            high => std_logic_vector(to_unsigned(16#1010# - 1, bus_address_type'length)),
             mapping => bus_map_constant(bus_address_type'high - 4, '0') & bus_map_range(4, 0)
         ),
         address_range_and_map(
@@ -87,13 +95,19 @@ begin
     externalMaster : entity work.uart_bus_master
     generic map (
         clk_period => clk_period,
-        baud_rate => baud_rate
+        baud_rate => baud_rate,
+        serial_bypass => master_serial_bypass
     ) port map (
         clk => clk,
         mst2slv => extMaster2arbiter,
         slv2mst => arbiter2extMaster,
         rx => master_rx,
-        tx => master_tx
+        tx => master_tx,
+        bypass_rx_byte => master_bypass_rx_byte,
+        bypass_rx_valid => master_bypass_rx_valid,
+        bypass_rx_ready => master_bypass_rx_ready,
+        bypass_tx_byte => master_bypass_tx_byte,
+        bypass_tx_valid => master_bypass_tx_valid
     );
 
     processor : entity work.riscv32_processor
@@ -32,7 +32,8 @@ end entity;
 
 architecture behaviourial of riscv32_coprocessor_zero is
     constant clk_frequency : natural := (1 sec)/clk_period;
-    signal regFile : riscv32_pkg.riscv32_data_array(0 to 1);
+    -- 0: control (reset, stall), 1: clock frequency, 2 and 3: cycle counter, low and high word
+    signal regFile : riscv32_pkg.riscv32_data_array(0 to 3);
 begin
 
     cpu_reset <= regFile(0)(0) = '1';
@@ -40,6 +41,20 @@ begin
 
     regFile(1) <= std_logic_vector(to_unsigned(clk_frequency, regFile(1)'length));
 
+    cycleCounter : process(clk)
+        variable count : unsigned(63 downto 0) := (others => '0');
+    begin
+        if rising_edge(clk) then
+            if rst = '1' then
+                count := (others => '0');
+            else
+                count := count + 1;
+            end if;
+        end if;
+        regFile(2) <= std_logic_vector(count(31 downto 0));
+        regFile(3) <= std_logic_vector(count(63 downto 32));
+    end process;
+
     controller_reader : process(address_from_controller, regFile)
     begin
         if address_from_controller > regFile'high then
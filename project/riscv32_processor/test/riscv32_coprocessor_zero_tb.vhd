@@ -41,6 +41,7 @@ begin
     clk <= not clk after (clk_period/2);
 
     main : process
+        variable previous_count : riscv32_pkg.riscv32_data_type;
     begin
         test_runner_setup(runner, runner_cfg);
         while test_suite loop
@@ -149,6 +150,23 @@ begin
                 address_from_pipeline <= 1;
                 wait until falling_edge(clk);
                 check_equal(to_integer(unsigned(data_to_pipeline)), clk_frequency);
+            elsif run("Address 2 from controller counts cycles") then
+                wait until falling_edge(clk);
+                address_from_controller <= 2;
+                wait until falling_edge(clk);
+                previous_count := data_to_controller;
+                wait until falling_edge(clk);
+                check_equal(unsigned(data_to_controller), unsigned(previous_count) + 1);
+            elsif run("rst resets the cycle counter") then
+                wait until falling_edge(clk);
+                wait until falling_edge(clk);
+                rst <= '1';
+                address_from_controller <= 2;
+                wait until falling_edge(clk);
+                check_equal(to_integer(unsigned(data_to_controller)), 0);
+                address_from_controller <= 3;
+                wait until falling_edge(clk);
+                check_equal(to_integer(unsigned(data_to_controller)), 0);
             end if;
         end loop;
         wait until rising_edge(clk);
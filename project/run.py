@@ -1,3 +1,4 @@
+import os
 from pathlib import Path
 from vunit import VUnit
 
@@ -20,6 +21,13 @@ tb_library.add_source_files(SRC_PATH / "bus" / "test" / "*.vhd")
 
 tb_library.add_source_files(SRC_PATH / "complete_system"/ "test" / "*.vhd")
 
+# The cosimulation bench links in C code, which the GHDL mcode backend cannot do, and it waits for a host to connect.
+# It is therefore only added on request: UART_COSIM_PTY=/tmp/uart_cosim python3 run.py tb.main_file_cosim_tb.*
+if "UART_COSIM_PTY" in os.environ:
+    tb_library.add_source_files(SRC_PATH / "complete_system" / "cosim" / "*.vhd")
+    tb_library.test_bench("main_file_cosim_tb").set_sim_option(
+        "ghdl.elab_flags", ["-Wl," + str(SRC_PATH / "complete_system" / "cosim" / "uart_cosim_bridge.c")])
+
 src_library.add_source_files(SRC_PATH / "triple_23lc1024_controller" / "*.vhd")
 tb_library.add_source_files(SRC_PATH / "triple_23lc1024_controller"/ "test" / "*.vhd")
 
@@ -147,8 +147,13 @@ begin
                 wait for clk_period;
                 wait for clk_period;
                 check(read_request);
-            elsif run("A burst operation where the next operation would cross a segment line is illegal") then
+            elsif run("A burst operation where the next operation would cross a segment line is legal") then
                 mst2slv <= bus_pkg.bus_mst2slv_read(X"0001fffc", burst => '1');
+                wait until rising_edge(clk) and read_request;
+                check(not has_fault);
+                check(cs_request = request_zero);
+            elsif run("A burst operation where the next operation would leave the last segment is illegal") then
+                mst2slv <= bus_pkg.bus_mst2slv_read(X"0005fffc", burst => '1');
                 wait until rising_edge(clk) and has_fault;
                 check(fault_data = bus_pkg.bus_fault_illegal_address_for_burst);
             elsif run("Aligned read with bytemask 0110 leads to size 4 read") then
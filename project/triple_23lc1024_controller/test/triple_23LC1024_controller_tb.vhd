@@ -46,6 +46,8 @@ architecture tb of triple_23LC1024_controller_tb is
 
     signal spi_sio_in : std_logic_vector(3 downto 0);
     signal spi_sio_out : std_logic_vector(3 downto 0);
+
+    signal cs_selections : natural := 0;
 begin
     clk <= not clk after (clk_period/2);
 
@@ -59,6 +61,8 @@ begin
         variable expected_data : bus_pkg.bus_data_type := (others => '0');
         variable read_data : bus_pkg.bus_data_type := (others => '0');
         variable burst_size : natural := 0;
+        variable start_address : natural := 0;
+        variable selections_before : natural := 0;
     begin
         test_runner_setup(runner, runner_cfg);
         while test_suite loop
@@ -202,6 +206,56 @@ begin
                     expected_data := std_logic_vector(to_unsigned(i + burst_size + burst_size, bus_pkg.bus_data_type'length));
                     check_equal(slv2mst.readData, expected_data);
                 end loop;
+            elsif run("Bursted write-then-read across memory boundaries works") then
+                rst <= '0';
+                burst_size := 16;
+                start_address := 16#1ffe0#;
+                for i in 0 to burst_size - 1 loop
+                    mst2slv <= bus_pkg.bus_mst2slv_write(std_logic_vector(to_unsigned(start_address + i*4, bus_pkg.bus_address_type'length)),
+                                                        std_logic_vector(to_unsigned(16#5A000000# + i, bus_pkg.bus_data_type'length)),
+                                                        X"F",
+                                                        '1');
+                    if i = burst_size - 1 then
+                        mst2slv.burst <= '0';
+                    end if;
+                    wait until rising_edge(clk) and bus_pkg.write_transaction(mst2slv, slv2mst);
+                end loop;
+                mst2slv <= bus_pkg.BUS_MST2SLV_IDLE;
+                wait until rising_edge(cs_n(1));
+                -- The words before the boundary ended up at the end of the first memory, the rest at the start of the second one.
+                triple_23lc1024_tb_pkg.read_bus_word(net, actor_mem0, std_logic_vector(to_unsigned(16#1fffc#, 17)), read_data);
+                check_equal(read_data, triple_23lc1024_tb_pkg.reorder_nibbles(X"5A000007"));
+                triple_23lc1024_tb_pkg.read_bus_word(net, actor_mem1, std_logic_vector(to_unsigned(0, 17)), read_data);
+                check_equal(read_data, triple_23lc1024_tb_pkg.reorder_nibbles(X"5A000008"));
+                for i in 0 to burst_size - 1 loop
+                    mst2slv <= bus_pkg.bus_mst2slv_read(std_logic_vector(to_unsigned(start_address + i*4, bus_pkg.bus_address_type'length)), burst => '1');
+                    if i = burst_size - 1 then
+                        mst2slv.burst <= '0';
+                    end if;
+                    wait until rising_edge(clk) and bus_pkg.read_transaction(mst2slv, slv2mst);
+                    expected_data := std_logic_vector(to_unsigned(16#5A000000# + i, bus_pkg.bus_data_type'length));
+                    check_equal(slv2mst.readData, expected_data);
+                end loop;
+                mst2slv <= bus_pkg.BUS_MST2SLV_IDLE;
+            elsif run("A burst read selects every memory it touches only once") then
+                rst <= '0';
+                burst_size := 8;
+                start_address := 16#3fff0#;
+                -- Make sure configuration is done and the chip selects are idle before counting
+                mst2slv <= bus_pkg.bus_mst2slv_read(X"00000000");
+                wait until rising_edge(clk) and bus_pkg.read_transaction(mst2slv, slv2mst);
+                mst2slv <= bus_pkg.BUS_MST2SLV_IDLE;
+                wait until rising_edge(cs_n(0));
+                selections_before := cs_selections;
+                for i in 0 to burst_size - 1 loop
+                    mst2slv <= bus_pkg.bus_mst2slv_read(std_logic_vector(to_unsigned(start_address + i*4, bus_pkg.bus_address_type'length)), burst => '1');
+                    if i = burst_size - 1 then
+                        mst2slv.burst <= '0';
+                    end if;
+                    wait until rising_edge(clk) and bus_pkg.read_transaction(mst2slv, slv2mst);
+                end loop;
+                mst2slv <= bus_pkg.BUS_MST2SLV_IDLE;
+                check_equal(cs_selections - selections_before, 2);
             elsif run ("Partial write then read works") then
                 rst <= '0';
                 triple_23lc1024_tb_pkg.write_bus_word(net, actor_mem0, std_logic_vector(to_unsigned(0, 17)), triple_23lc1024_tb_pkg.reorder_nibbles(X"87654321"));
@@ -229,6 +283,15 @@ begin
 
     test_runner_watchdog(runner, 1 ms);
 
+    cs_selection_counter : process(cs_n)
+    begin
+        for i in cs_n'range loop
+            if falling_edge(cs_n(i)) then
+                cs_selections <= cs_selections + 1;
+            end if;
+        end loop;
+    end process;
+
     mem_pcb : entity tb.triple_M23LC1024
     port map (
         cs_n => cs_n,
@@ -111,7 +111,8 @@ architecture behavioral of triple_23lc1024_bus_parser is
             if current_address > max_address then
                 has_fault_buf := true;
                 fault_data_buf := bus_pkg.bus_fault_address_out_of_range;
-            elsif mst2slv_buf.burst = '1' and current_address(16 downto 0) > next_address_on_burst(16 downto 0) then
+            -- Bursts that cross into the next memory are split by the reader and writer, only the end of the last memory is a problem.
+            elsif mst2slv_buf.burst = '1' and next_address_on_burst > max_address then
                 has_fault_buf := true;
                 fault_data_buf := bus_pkg.bus_fault_illegal_address_for_burst;
             else
@@ -73,8 +73,13 @@ architecture behavioral of triple_23lc1024_controller is
     signal cs_request : cs_request_type;
     signal write_data : bus_data_type;
     signal address : bus_address_type;
+    -- Burst as seen by the reader and writer. Low on the last word of a memory, so that a burst that continues in the
+    -- next memory ends the sequential transfer there and starts a new one on the next chip.
+    signal burst_within_chip : std_logic;
 begin
 
+    burst_within_chip <= mst2slv.burst when is_address_legal_for_burst(mst2slv.address) else '0';
+
     slv2mst.fault <= '1' when has_fault else '0';
     slv2mst.valid <= valid_read or valid_write;
 
@@ -176,7 +181,7 @@ begin
         cs_request_out => cs_request_reader,
         request_length => request_length,
         read_data => slv2mst.readData,
-        burst => mst2slv.burst
+        burst => burst_within_chip
     );
 
     writer : entity work.triple_23lc1024_writer
@@ -199,7 +204,7 @@ begin
         cs_request_out => cs_request_writer,
         request_length => request_length,
         write_data => write_data,
-        burst => mst2slv.burst
+        burst => burst_within_chip
     );
 
     parser : entity work.triple_23lc1024_bus_parser
@@ -24,11 +24,11 @@ package body triple_23lc1024_pkg is
     pure function is_address_legal_for_burst (
         address : bus_address_type
     ) return boolean is
-        constant addr_num : natural := to_integer(unsigned(address));
-        variable new_addr : natural := addr_num + bus_bytes_per_word;
-        constant mask : natural := 16#20000#;
+        -- The next word lies in the same memory unless this is the last word of it.
+        -- Compared bitwise, so that any bus address can be passed in without overflowing a natural.
+        constant last_word : std_logic_vector(16 downto 2) := (others => '1');
     begin
-        return (addr_num mod mask) < (new_addr mod mask);
+        return address(16 downto 2) /= last_word;
     end is_address_legal_for_burst;
 
     pure function encode_cs_request_type (
@@ -0,0 +1,133 @@
+library ieee;
+use ieee.std_logic_1164.all;
+use ieee.numeric_std.all;
+
+library vunit_lib;
+context vunit_lib.vunit_context;
+context vunit_lib.com_context;
+use vunit_lib.queue_pkg.all;
+
+library src;
+use src.bus_pkg;
+use src.uart_bus_master_pkg;
+
+library tb;
+use tb.simulated_bus_memory_pkg;
+
+entity uart_bus_master_bypass_tb is
+    generic (
+        runner_cfg : string);
+end entity;
+
+architecture tb of uart_bus_master_bypass_tb is
+    constant clk_period : time := 20 ns;
+    constant baud_rate : positive := 5000000;
+
+    signal clk : std_logic := '0';
+    signal tx : std_logic;
+
+    signal mst2slv : bus_pkg.bus_mst2slv_type;
+    signal slv2mst : bus_pkg.bus_slv2mst_type;
+
+    signal rx_byte : std_logic_vector(7 downto 0) := (others => '0');
+    signal rx_valid : boolean := false;
+    signal rx_ready : boolean;
+    signal tx_byte : std_logic_vector(7 downto 0);
+    signal tx_valid : boolean;
+
+    constant tx_bytes : queue_t := new_queue;
+    constant slaveActor : actor_t := new_actor("slave");
+begin
+    clk <= not clk after (clk_period/2);
+
+    main : process
+        procedure push_byte(constant data : in std_logic_vector(7 downto 0)) is
+        begin
+            wait until rising_edge(clk) and rx_ready;
+            rx_byte <= data;
+            rx_valid <= true;
+            wait until rising_edge(clk);
+            rx_valid <= false;
+            for i in 0 to 2 loop
+                wait until rising_edge(clk);
+            end loop;
+        end procedure;
+
+        procedure check_byte(constant expected : in std_logic_vector(7 downto 0)) is
+        begin
+            while is_empty(tx_bytes) loop
+                wait until rising_edge(clk);
+            end loop;
+            check_equal(pop_std_ulogic_vector(tx_bytes), expected);
+        end procedure;
+    begin
+        test_runner_setup(runner, runner_cfg);
+        while test_suite loop
+            if run("Erronous command results in command error") then
+                push_byte(x"ff");
+                check_byte(uart_bus_master_pkg.ERROR_UNKOWN_COMMAND);
+            elsif run("Aligned read works as expected") then
+                simulated_bus_memory_pkg.write_to_address(net, slaveActor, X"00000004", X"67452301", X"f");
+                push_byte(uart_bus_master_pkg.COMMAND_READ_WORD);
+                check_byte(uart_bus_master_pkg.ERROR_NO_ERROR);
+                push_byte(x"04");
+                push_byte(x"00");
+                push_byte(x"00");
+                push_byte(x"00");
+                check_byte(x"01");
+                check_byte(x"23");
+                check_byte(x"45");
+                check_byte(x"67");
+                check_byte(uart_bus_master_pkg.ERROR_NO_ERROR);
+            elsif run("Serial tx stays idle") then
+                push_byte(x"ff");
+                check_byte(uart_bus_master_pkg.ERROR_UNKOWN_COMMAND);
+                check_equal(tx, '1');
+            end if;
+        end loop;
+        wait until rising_edge(clk);
+        wait until falling_edge(clk);
+        test_runner_cleanup(runner);
+        wait;
+    end process;
+
+    test_runner_watchdog(runner,  1 ms);
+
+    tx_monitor : process(clk)
+    begin
+        if rising_edge(clk) and tx_valid then
+            push_std_ulogic_vector(tx_bytes, tx_byte);
+        end if;
+    end process;
+
+    bus_master : entity src.uart_bus_master
+    generic map (
+        clk_period => clk_period,
+        baud_rate => baud_rate,
+        serial_bypass => true
+    ) port map (
+        clk => clk,
+        tx => tx,
+        rx => '1',
+        mst2slv => mst2slv,
+        slv2mst => slv2mst,
+        bypass_rx_byte => rx_byte,
+        bypass_rx_valid => rx_valid,
+        bypass_rx_ready => rx_ready,
+        bypass_tx_byte => tx_byte,
+        bypass_tx_valid => tx_valid
+    );
+
+    bus_slave : entity tb.simulated_bus_memory
+    generic map (
+        depth_log2b => 4,
+        allow_unaligned_access => false,
+        actor => slaveActor,
+        read_delay => 5,
+        write_delay => 5
+    ) port map (
+        clk => clk,
+        mst2mem => mst2slv,
+        mem2mst => slv2mst
+    );
+end architecture;
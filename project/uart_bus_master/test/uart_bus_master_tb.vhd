@@ -28,6 +28,9 @@ architecture tb of uart_bus_master_tb is
 
     signal mst2slv : bus_pkg.bus_mst2slv_type;
     signal slv2mst : bus_pkg.bus_slv2mst_type;
+    signal mem2mst : bus_pkg.bus_slv2mst_type;
+    -- Keeps the memory from answering, so that the host can get ahead of the bus.
+    signal hold_bus : boolean := false;
 
     constant uart_slave_bfm : uart_slave_t := new_uart_slave(initial_baud_rate => baud_rate);
     constant uart_slave_stream : stream_slave_t := as_stream(uart_slave_bfm);
@@ -37,6 +40,11 @@ architecture tb of uart_bus_master_tb is
 
     constant slaveActor : actor_t := new_actor("slave");
 
+    signal burst_seen : boolean := false;
+    -- Longest time burst was held high without a request, a byte on the UART takes 100 cycles.
+    signal longest_burst_gap : natural := 0;
+    constant max_burst_gap : natural := 25;
+
 begin
     clk <= not clk after (clk_period/2);
 
@@ -44,6 +52,7 @@ begin
         variable expected_return : std_logic_vector(7 downto 0);
         variable uart_return_data : std_logic_vector(7 downto 0);
         variable return_data : bus_pkg.bus_data_type;
+        variable last_request : bus_pkg.bus_mst2slv_type;
     begin
         test_runner_setup(runner, runner_cfg);
         while test_suite loop
@@ -265,6 +274,122 @@ begin
                 check_stream(net, uart_slave_stream, x"44");
                 check_stream(net, uart_slave_stream, x"44");
                 check_stream(net, uart_slave_stream, uart_bus_master_pkg.ERROR_NO_ERROR);
+            elsif run("Read sequence is a burst that ends on the last word") then
+                push_stream(net, uart_master_stream, uart_bus_master_pkg.COMMAND_READ_WORD_SEQUENCE);
+                check_stream(net, uart_slave_stream, uart_bus_master_pkg.ERROR_NO_ERROR);
+                push_stream(net, uart_master_stream, x"00");
+                push_stream(net, uart_master_stream, x"00");
+                push_stream(net, uart_master_stream, x"00");
+                push_stream(net, uart_master_stream, x"00");
+                push_stream(net, uart_master_stream, x"01");
+                for i in 0 to 7 loop
+                    pop_stream(net, uart_slave_stream, uart_return_data);
+                end loop;
+                check_stream(net, uart_slave_stream, uart_bus_master_pkg.ERROR_NO_ERROR);
+                check(burst_seen);
+                simulated_bus_memory_pkg.read_lastMasterReq(net, slaveActor, last_request);
+                check_equal(last_request.address, std_logic_vector'(X"00000004"));
+                check_equal(last_request.burst, '0');
+                check_equal(mst2slv.burst, '0');
+            elsif run("Streamed write sequence does not burst ahead of the UART") then
+                push_stream(net, uart_master_stream, uart_bus_master_pkg.COMMAND_WRITE_WORD_SEQUENCE);
+                check_stream(net, uart_slave_stream, uart_bus_master_pkg.ERROR_NO_ERROR);
+                push_stream(net, uart_master_stream, x"00");
+                push_stream(net, uart_master_stream, x"00");
+                push_stream(net, uart_master_stream, x"00");
+                push_stream(net, uart_master_stream, x"00");
+                push_stream(net, uart_master_stream, x"01");
+                for i in 0 to 7 loop
+                    push_stream(net, uart_master_stream, x"55");
+                end loop;
+                check_stream(net, uart_slave_stream, uart_bus_master_pkg.ERROR_NO_ERROR);
+                check(not burst_seen);
+                simulated_bus_memory_pkg.read_lastMasterReq(net, slaveActor, last_request);
+                check_equal(last_request.address, std_logic_vector'(X"00000004"));
+                check_equal(last_request.burst, '0');
+                check_equal(mst2slv.burst, '0');
+            elsif run("Single word read does not burst") then
+                push_stream(net, uart_master_stream, uart_bus_master_pkg.COMMAND_READ_WORD);
+                check_stream(net, uart_slave_stream, uart_bus_master_pkg.ERROR_NO_ERROR);
+                push_stream(net, uart_master_stream, x"00");
+                push_stream(net, uart_master_stream, x"00");
+                push_stream(net, uart_master_stream, x"00");
+                push_stream(net, uart_master_stream, x"00");
+                for i in 0 to 3 loop
+                    pop_stream(net, uart_slave_stream, uart_return_data);
+                end loop;
+                check_stream(net, uart_slave_stream, uart_bus_master_pkg.ERROR_NO_ERROR);
+                check(not burst_seen);
+            elsif run("Write sequence bursts words that were received ahead") then
+                hold_bus <= true;
+                push_stream(net, uart_master_stream, uart_bus_master_pkg.COMMAND_WRITE_WORD_SEQUENCE);
+                check_stream(net, uart_slave_stream, uart_bus_master_pkg.ERROR_NO_ERROR);
+                push_stream(net, uart_master_stream, x"00");
+                push_stream(net, uart_master_stream, x"00");
+                push_stream(net, uart_master_stream, x"00");
+                push_stream(net, uart_master_stream, x"00");
+                push_stream(net, uart_master_stream, x"02");
+                for i in 0 to 11 loop
+                    push_stream(net, uart_master_stream, x"55");
+                end loop;
+                wait_until_idle(net, as_sync(uart_master_bfm));
+                check(not burst_seen);
+                hold_bus <= false;
+                check_stream(net, uart_slave_stream, uart_bus_master_pkg.ERROR_NO_ERROR);
+                check(burst_seen);
+                check(longest_burst_gap <= max_burst_gap);
+                simulated_bus_memory_pkg.read_lastMasterReq(net, slaveActor, last_request);
+                check_equal(last_request.address, std_logic_vector'(X"00000008"));
+                check_equal(last_request.burst, '0');
+                simulated_bus_memory_pkg.read_from_address(net, slaveActor, X"00000008", return_data);
+                check(return_data = X"55555555");
+            elsif run("Stalled write sequence ends the burst") then
+                push_stream(net, uart_master_stream, uart_bus_master_pkg.COMMAND_WRITE_WORD_SEQUENCE);
+                check_stream(net, uart_slave_stream, uart_bus_master_pkg.ERROR_NO_ERROR);
+                push_stream(net, uart_master_stream, x"00");
+                push_stream(net, uart_master_stream, x"00");
+                push_stream(net, uart_master_stream, x"00");
+                push_stream(net, uart_master_stream, x"00");
+                push_stream(net, uart_master_stream, x"01");
+                for i in 0 to 3 loop
+                    push_stream(net, uart_master_stream, x"11");
+                end loop;
+                wait until mst2slv.writeReady = '1';
+                wait until mst2slv.writeReady = '0';
+                wait for 10 us;
+                check_equal(mst2slv.burst, '0');
+                check(not bus_pkg.bus_requesting(mst2slv));
+                for i in 0 to 3 loop
+                    push_stream(net, uart_master_stream, x"22");
+                end loop;
+                check_stream(net, uart_slave_stream, uart_bus_master_pkg.ERROR_NO_ERROR);
+                check(longest_burst_gap <= max_burst_gap);
+                simulated_bus_memory_pkg.read_from_address(net, slaveActor, X"00000000", return_data);
+                check(return_data = X"11111111");
+                simulated_bus_memory_pkg.read_from_address(net, slaveActor, X"00000004", return_data);
+                check(return_data = X"22222222");
+            elsif run("Read sequence ends the burst when the UART falls behind") then
+                for i in 0 to 15 loop
+                    simulated_bus_memory_pkg.write_to_address(net, slaveActor, std_logic_vector(to_unsigned(i*4, 32)),
+                                                              std_logic_vector(to_unsigned(i, 32)), X"f");
+                end loop;
+                push_stream(net, uart_master_stream, uart_bus_master_pkg.COMMAND_READ_WORD_SEQUENCE);
+                check_stream(net, uart_slave_stream, uart_bus_master_pkg.ERROR_NO_ERROR);
+                push_stream(net, uart_master_stream, x"00");
+                push_stream(net, uart_master_stream, x"00");
+                push_stream(net, uart_master_stream, x"00");
+                push_stream(net, uart_master_stream, x"00");
+                push_stream(net, uart_master_stream, x"0f");
+                for i in 0 to 15 loop
+                    check_stream(net, uart_slave_stream, std_logic_vector(to_unsigned(i, 8)));
+                    check_stream(net, uart_slave_stream, x"00");
+                    check_stream(net, uart_slave_stream, x"00");
+                    check_stream(net, uart_slave_stream, x"00");
+                end loop;
+                check_stream(net, uart_slave_stream, uart_bus_master_pkg.ERROR_NO_ERROR);
+                check(burst_seen);
+                check(longest_burst_gap <= max_burst_gap);
+                check_equal(mst2slv.burst, '0');
             end if;
         end loop;
         wait until rising_edge(clk);
@@ -275,6 +400,26 @@ begin
 
     test_runner_watchdog(runner,  1 ms);
 
+    burst_monitor : process(clk)
+        variable gap : natural := 0;
+    begin
+        if rising_edge(clk) then
+            if mst2slv.burst = '1' then
+                burst_seen <= true;
+            end if;
+            if mst2slv.burst = '1' and not bus_pkg.bus_requesting(mst2slv) then
+                gap := gap + 1;
+                if gap > longest_burst_gap then
+                    longest_burst_gap <= gap;
+                end if;
+            else
+                gap := 0;
+            end if;
+        end if;
+    end process;
+
+    slv2mst <= bus_pkg.BUS_SLV2MST_IDLE when hold_bus else mem2mst;
+
     bus_master : entity src.uart_bus_master
     generic map (
         clk_period => clk_period,
@@ -301,7 +446,7 @@ begin
 
     bus_slave : entity tb.simulated_bus_memory
     generic map (
-        depth_log2b => 4,
+        depth_log2b => 6,
         allow_unaligned_access => false,
         actor => slaveActor,
         read_delay => 5,
@@ -309,6 +454,6 @@ begin
     ) port map (
         clk => clk,
         mst2mem => mst2slv,
-        mem2mst => slv2mst
+        mem2mst => mem2mst
     );
 end architecture;
@@ -9,7 +9,10 @@ use work.uart_bus_master_pkg;
 entity uart_bus_master is
     generic (
         clk_period : time;
-        baud_rate : positive
+        baud_rate : positive;
+        -- When true, rx and tx are unused and bytes are exchanged via the bypass ports instead.
+        -- Only intended for simulation, where serializing every bit is a waste of time.
+        serial_bypass : boolean := false
     );
     port (
         clk : in std_logic;
@@ -18,7 +21,15 @@ entity uart_bus_master is
         tx : out std_logic;
 
         mst2slv : out bus_pkg.bus_mst2slv_type;
-        slv2mst : in bus_pkg.bus_slv2mst_type
+        slv2mst : in bus_pkg.bus_slv2mst_type;
+
+        -- bypass_rx_valid must be a single cycle pulse, at most once every four cycles and only while bypass_rx_ready.
+        bypass_rx_byte : in std_logic_vector(7 downto 0) := (others => '0');
+        bypass_rx_valid : in boolean := false;
+        bypass_rx_ready : out boolean;
+        -- bypass_tx_valid is a single cycle pulse for every byte the bus master sends.
+        bypass_tx_byte : out std_logic_vector(7 downto 0);
+        bypass_tx_valid : out boolean
     );
 end entity;
 
@@ -27,6 +38,9 @@ architecture behaviourial of uart_bus_master is
     type command_type is (no_command, command_read_word, command_write_word, command_read_word_sequence, command_write_word_sequence);
     type state_type is (state_wait_for_command, state_command_response, state_wait_for_address, state_wait_for_count, state_read_word_from_uart, state_write_word_to_bus, state_read_word_from_bus, state_write_word_to_uart, state_finalize);
 
+    constant queue_depth_log2b : natural := 4;
+    constant bytes_per_word : natural := 4;
+
     signal tx_byte : std_logic_vector(7 downto 0) := (others => '0');
     signal tx_data_ready : boolean := false;
     signal tx_busy : boolean;
@@ -41,6 +55,7 @@ architecture behaviourial of uart_bus_master is
     signal tx_queue_pop_data : boolean := false;
     signal tx_queue_empty : boolean;
     signal tx_queue_full : boolean;
+    signal tx_queue_count : natural range 0 to 2**queue_depth_log2b;
 
     -- rx_queue_signals
     signal rx_queue_data_in : std_logic_vector(7 downto 0);
@@ -48,12 +63,17 @@ architecture behaviourial of uart_bus_master is
     signal rx_queue_data_out : std_logic_vector(7 downto 0);
     signal rx_queue_pop_data : boolean := false;
     signal rx_queue_empty : boolean;
+    signal rx_queue_full : boolean;
+    signal rx_queue_count : natural range 0 to 2**queue_depth_log2b;
 
     signal address_to_bus : bus_pkg.bus_address_type;
     signal data_to_bus : bus_pkg.bus_data_type;
     signal data_from_bus : bus_pkg.bus_data_type;
     signal bus_do_read : boolean := false;
     signal bus_do_write : boolean := false;
+    -- Set together with bus_do_read/bus_do_write while more words of the sequence follow and the UART already has room
+    -- for, or has received, the next word. The burst never holds the bus while waiting for the host.
+    signal bus_burst : boolean := false;
     signal bus_finished : boolean := false;
     signal bus_fault : boolean := false;
     signal bus_last_fault : bus_pkg.bus_fault_type := bus_pkg.bus_fault_no_fault;
@@ -183,12 +203,25 @@ begin
 
         variable bus_fault_occured : boolean := false;
         variable first_bus_fault : bus_pkg.bus_fault_type;
+
+        -- The queue counts lag the push and pop of the previous cycle, which are taken into account here.
+        variable rx_queue_available : integer;
+        variable tx_queue_room : integer;
     begin
         if rising_edge(clk) then
+            rx_queue_available := rx_queue_count;
+            if rx_queue_pop_data then
+                rx_queue_available := rx_queue_available - 1;
+            end if;
+            tx_queue_room := 2**queue_depth_log2b - tx_queue_count;
+            if tx_queue_push_data then
+                tx_queue_room := tx_queue_room - 1;
+            end if;
             rx_queue_pop_data <= false;
             tx_queue_push_data <= false;
             bus_do_read <= false;
             bus_do_write <= false;
+            bus_burst <= false;
             cur_state := next_state;
             case cur_state is
                 when state_wait_for_command =>
@@ -247,6 +280,7 @@ begin
                         next_state := state_write_word_to_uart;
                     else
                         bus_do_read <= true;
+                        bus_burst <= sequence_size /= 0 and not bus_fault_occured and tx_queue_room >= bytes_per_word;
                     end if;
                 when state_write_word_to_uart =>
                     word_to_tx_queue(queue_wait_cycle, word_index_counter, data_from_bus, tx_queue_data_in, tx_queue_full,
@@ -268,8 +302,10 @@ begin
                     end if;
                 when state_write_word_to_bus =>
                     bus_do_write <= true;
+                    bus_burst <= sequence_size /= 0 and not bus_fault_occured and rx_queue_available >= bytes_per_word;
                     if bus_finished then
                         bus_do_write <= false;
+                        bus_burst <= false;
                         if not bus_fault_occured and bus_fault then
                             first_bus_fault := bus_last_fault;
                             bus_fault_occured := true;
@@ -304,6 +340,7 @@ begin
 
     bus_handling : process(clk)
         variable mst2slv_buf : bus_pkg.bus_mst2slv_type := bus_pkg.BUS_MST2SLV_IDLE;
+        variable burst_bit : std_logic;
     begin
         if rising_edge(clk) then
             if bus_finished then
@@ -313,17 +350,26 @@ begin
                 if bus_pkg.fault_transaction(mst2slv_buf, slv2mst) then
                     bus_last_fault <= slv2mst.faultData;
                     bus_fault <= true;
+                    mst2slv_buf := bus_pkg.BUS_MST2SLV_IDLE;
                 else
                     bus_fault <= false;
+                    -- Within a burst only the request is withdrawn, burst stays high until the last word is requested.
+                    mst2slv_buf.readReady := '0';
+                    mst2slv_buf.writeReady := '0';
+                    if mst2slv_buf.burst /= '1' then
+                        mst2slv_buf := bus_pkg.BUS_MST2SLV_IDLE;
+                    end if;
                 end if;
-                mst2slv_buf := bus_pkg.BUS_MST2SLV_IDLE;
                 bus_finished <= true;
             elsif bus_pkg.bus_requesting(mst2slv_buf) then
                 -- pass
-            elsif bus_do_read then
-                mst2slv_buf := bus_pkg.bus_mst2slv_read(address_to_bus);
-            elsif bus_do_write then
-                mst2slv_buf := bus_pkg.bus_mst2slv_write(address_to_bus, data_to_bus);
+            else
+                burst_bit := '1' when bus_burst else '0';
+                if bus_do_read then
+                    mst2slv_buf := bus_pkg.bus_mst2slv_read(address_to_bus, burst => burst_bit);
+                elsif bus_do_write then
+                    mst2slv_buf := bus_pkg.bus_mst2slv_write(address_to_bus, data_to_bus, burst => burst_bit);
+                end if;
             end if;
         end if;
         mst2slv <= mst2slv_buf;
@@ -358,34 +404,57 @@ begin
         end if;
     end process;
 
-    bus_master_tx : entity work.uart_bus_master_tx
-    generic map (
-        clk_period => clk_period,
-        baud_rate => baud_rate
-    ) port map (
-        clk => clk,
-        rst => '0',
-        tx => tx,
-        transmit_byte => tx_byte,
-        data_ready => tx_data_ready,
-        busy => tx_busy
-    );
+    serial_gen : if not serial_bypass generate
+        bypass_rx_ready <= false;
+        bypass_tx_byte <= (others => '0');
+        bypass_tx_valid <= false;
 
-    bus_master_rx : entity work.uart_bus_master_rx
-    generic map (
-        clk_period => clk_period,
-        baud_rate => baud_rate
-    ) port map (
-        clk => clk,
-        rst => '0',
-        rx => rx,
-        receive_byte => rx_byte,
-        data_ready => rx_data_ready
-    );
+        bus_master_tx : entity work.uart_bus_master_tx
+        generic map (
+            clk_period => clk_period,
+            baud_rate => baud_rate
+        ) port map (
+            clk => clk,
+            rst => '0',
+            tx => tx,
+            transmit_byte => tx_byte,
+            data_ready => tx_data_ready,
+            busy => tx_busy
+        );
+
+        bus_master_rx : entity work.uart_bus_master_rx
+        generic map (
+            clk_period => clk_period,
+            baud_rate => baud_rate
+        ) port map (
+            clk => clk,
+            rst => '0',
+            rx => rx,
+            receive_byte => rx_byte,
+            data_ready => rx_data_ready
+        );
+    end generate;
+
+    bypass_gen : if serial_bypass generate
+        tx <= '1';
+        rx_byte <= bypass_rx_byte;
+        rx_data_ready <= bypass_rx_valid;
+        bypass_rx_ready <= not rx_queue_full;
+        bypass_tx_byte <= tx_byte;
+        bypass_tx_valid <= tx_data_ready;
+
+        -- tx_from_queue_handling waits for busy to rise and fall again before it sends the next byte.
+        busy_emulation : process(clk)
+        begin
+            if rising_edge(clk) then
+                tx_busy <= tx_data_ready;
+            end if;
+        end process;
+    end generate;
 
     tx_queue : entity work.generic_fifo
     generic map (
-        depth_log2b => 4,
+        depth_log2b => queue_depth_log2b,
         word_size_log2b => 3
     )
     port map (
@@ -393,6 +462,7 @@ begin
         reset => false,
         empty => tx_queue_empty,
         full => tx_queue_full,
+        count => tx_queue_count,
         data_in => tx_queue_data_in,
         push_data => tx_queue_push_data,
         data_out => tx_queue_data_out,
@@ -401,13 +471,15 @@ begin
 
     rx_queue : entity work.generic_fifo
     generic map (
-        depth_log2b => 4,
+        depth_log2b => queue_depth_log2b,
         word_size_log2b => 3
     )
     port map (
         clk => clk,
         reset => false,
         empty => rx_queue_empty,
+        full => rx_queue_full,
+        count => rx_queue_count,
         data_in => rx_queue_data_in,
         push_data => rx_queue_push_data,
         data_out => rx_queue_data_out,
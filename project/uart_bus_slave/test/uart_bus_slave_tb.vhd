@@ -224,6 +224,73 @@ begin
                 wait until rising_edge(clk) and bus_pkg.read_transaction(mst2slv, slv2mst);
                 check_equal(slv2mst.readData(0), '0');
                 check_equal(slv2mst.readData(16), '0');
+            elsif run("Tunnel pops tx queue") then
+                -- Enable the transceiver
+                address := std_logic_vector(to_unsigned(1, address'length));
+                data := X"00010001";
+                byte_mask := "0101";
+                mst2slv <= bus_pkg.bus_mst2slv_write(address, data, byte_mask);
+                wait until rising_edge(clk) and bus_pkg.write_transaction(mst2slv, slv2mst);
+                -- Enable the tunnel
+                address := std_logic_vector(to_unsigned(12, address'length));
+                data := X"00010000";
+                mst2slv <= bus_pkg.bus_mst2slv_write(address, data);
+                wait until rising_edge(clk) and bus_pkg.write_transaction(mst2slv, slv2mst);
+                -- Queue two bytes
+                address := std_logic_vector(to_unsigned(0, address'length));
+                data := std_logic_vector(to_unsigned(16#AB#, data'length));
+                byte_mask := "0001";
+                mst2slv <= bus_pkg.bus_mst2slv_write(address, data, byte_mask);
+                wait until rising_edge(clk) and bus_pkg.write_transaction(mst2slv, slv2mst);
+                data := std_logic_vector(to_unsigned(16#AC#, data'length));
+                mst2slv <= bus_pkg.bus_mst2slv_write(address, data, byte_mask);
+                wait until rising_edge(clk) and bus_pkg.write_transaction(mst2slv, slv2mst);
+                -- Nothing is transmitted, so both are still queued
+                address := std_logic_vector(to_unsigned(4, address'length));
+                byte_mask := "0011";
+                mst2slv <= bus_pkg.bus_mst2slv_read(address, byte_mask);
+                wait until rising_edge(clk) and bus_pkg.read_transaction(mst2slv, slv2mst);
+                check_equal(slv2mst.readData(15 downto 0), std_logic_vector(to_unsigned(2, 16)));
+                -- Pop them through the tunnel
+                address := std_logic_vector(to_unsigned(12, address'length));
+                mst2slv <= bus_pkg.bus_mst2slv_read(address);
+                wait until rising_edge(clk) and bus_pkg.read_transaction(mst2slv, slv2mst);
+                check_equal(slv2mst.readData, std_logic_vector'(X"000101AB"));
+                wait until rising_edge(clk) and bus_pkg.read_transaction(mst2slv, slv2mst);
+                check_equal(slv2mst.readData, std_logic_vector'(X"000101AC"));
+                wait until rising_edge(clk) and bus_pkg.read_transaction(mst2slv, slv2mst);
+                check_equal(slv2mst.readData, std_logic_vector'(X"00010000"));
+                mst2slv <= bus_pkg.BUS_MST2SLV_IDLE;
+                check_equal(tx, '1');
+            elsif run("Tunnel pushes rx queue") then
+                -- Enable the transceiver
+                address := std_logic_vector(to_unsigned(1, address'length));
+                data := X"00010001";
+                byte_mask := "0101";
+                mst2slv <= bus_pkg.bus_mst2slv_write(address, data, byte_mask);
+                wait until rising_edge(clk) and bus_pkg.write_transaction(mst2slv, slv2mst);
+                -- Enable the tunnel and push two bytes
+                address := std_logic_vector(to_unsigned(12, address'length));
+                data := X"00010112";
+                mst2slv <= bus_pkg.bus_mst2slv_write(address, data);
+                wait until rising_edge(clk) and bus_pkg.write_transaction(mst2slv, slv2mst);
+                data := X"00010134";
+                mst2slv <= bus_pkg.bus_mst2slv_write(address, data);
+                wait until rising_edge(clk) and bus_pkg.write_transaction(mst2slv, slv2mst);
+                -- Check the rx queue count
+                address := std_logic_vector(to_unsigned(6, address'length));
+                byte_mask := "0011";
+                mst2slv <= bus_pkg.bus_mst2slv_read(address, byte_mask);
+                wait until rising_edge(clk) and bus_pkg.read_transaction(mst2slv, slv2mst);
+                check_equal(slv2mst.readData(15 downto 0), std_logic_vector(to_unsigned(2, 16)));
+                -- Pop them as the firmware would
+                address := std_logic_vector(to_unsigned(2, address'length));
+                byte_mask := "0001";
+                mst2slv <= bus_pkg.bus_mst2slv_read(address, byte_mask);
+                wait until rising_edge(clk) and bus_pkg.read_transaction(mst2slv, slv2mst);
+                check_equal(slv2mst.readData(7 downto 0), std_logic_vector'(X"12"));
+                wait until rising_edge(clk) and bus_pkg.read_transaction(mst2slv, slv2mst);
+                check_equal(slv2mst.readData(7 downto 0), std_logic_vector'(X"34"));
             end if;
         end loop;
         wait until rising_edge(clk) or falling_edge(clk);
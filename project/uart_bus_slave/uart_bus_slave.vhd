@@ -22,18 +22,26 @@ architecture behavioral of uart_bus_slave is
     -- First register, 4 byte, contains tx_data_in (wo), tx_enable (rw, single bit, lsb), data_out (ro), rx_enable(rw, single bit, lsb)
     -- Second register, 4 byte, contains tx_queue_count (16 bit, ro), rx_queue_size (16 bit, ro)
     -- Third register, 4 byte, contains baud_divider, 31 bit, unsigned value
+    -- Fourth register, 4 byte, full word access only, the host tunnel. Bit 16 enables the tunnel (rw), which disconnects
+    -- tx and rx from the queues. Writing bit 8 pushes bits 7..0 into the rx queue. Reading pops the tx queue into
+    -- bits 7..0 and sets bit 8 if there was something to pop.
     signal tx_reset_internal : boolean := true;
     signal rx_reset_internal : boolean := true;
     signal baud_clk_ticks : unsigned(31 downto 0);
     signal slv2mst_buf : bus_pkg.bus_slv2mst_type := bus_pkg.BUS_SLV2MST_IDLE;
     signal slv2mst_internal : bus_pkg.bus_slv2mst_type := bus_pkg.BUS_SLV2MST_IDLE;
     signal handle_bus_request : boolean := false;
+    signal tunnel_enabled : boolean := false;
+    signal tunnel_tx_pop : boolean := false;
+    signal tunnel_rx_push : boolean := false;
+    signal tunnel_rx_data : std_logic_vector(7 downto 0) := (others => '0');
 
     -- tx_queue_signals
     signal tx_queue_data_in : std_logic_vector(7 downto 0) := (others => '0');
     signal tx_queue_push_data : boolean := false;
     signal tx_queue_data_out : std_logic_vector(7 downto 0);
     signal tx_queue_pop_data : boolean;
+    signal writer_pop_data : boolean;
     signal tx_queue_empty : boolean;
     signal tx_queue_count : natural range 0 to 16;
     signal tx_queue_count_converted : std_logic_vector(15 downto 0);
@@ -41,6 +49,8 @@ architecture behavioral of uart_bus_slave is
     -- rx_queue_signals
     signal rx_queue_data_in : std_logic_vector(7 downto 0);
     signal rx_queue_push_data : boolean;
+    signal reader_data_out : std_logic_vector(7 downto 0);
+    signal reader_data_ready : boolean;
     signal rx_queue_data_out : std_logic_vector(7 downto 0);
     signal rx_queue_pop_data : boolean := false;
     signal rx_queue_empty : boolean;
@@ -52,17 +62,24 @@ begin
     rx_queue_count_converted <= std_logic_vector(to_unsigned(rx_queue_count, rx_queue_count_converted'length));
     slv2mst <= slv2mst_buf;
 
+    tx_queue_pop_data <= writer_pop_data or tunnel_tx_pop;
+    rx_queue_data_in <= tunnel_rx_data when tunnel_enabled else reader_data_out;
+    rx_queue_push_data <= tunnel_rx_push when tunnel_enabled else reader_data_ready;
+
     bus_request_handler : process(clk)
-       variable address : natural range 0 to 12;
+       variable address : natural range 0 to 15;
        variable subAddress : natural range 0 to 3;
        variable data_byte : std_logic_vector(7 downto 0);
     begin
         if rising_edge(clk) then
             tx_queue_push_data <= false;
             rx_queue_pop_data <= false;
+            tunnel_tx_pop <= false;
+            tunnel_rx_push <= false;
             if reset then
                 tx_reset_internal <= true;
                 rx_reset_internal <= true;
+                tunnel_enabled <= false;
             elsif handle_bus_request then
                 slv2mst_internal.valid <= true;
                 address := to_integer(unsigned(mst2slv.address(3 downto 0)));
@@ -114,6 +131,21 @@ begin
                         end if;
                     end if;
                 end loop;
+
+                if address = 12 and mst2slv.byteMask = "1111" then
+                    slv2mst_internal.readData <= (others => '0');
+                    slv2mst_internal.readData(16) <= '1' when tunnel_enabled else '0';
+                    if mst2slv.writeReady = '1' then
+                        tunnel_enabled <= mst2slv.writeData(16) = '1';
+                        tunnel_rx_push <= mst2slv.writeData(8) = '1';
+                        tunnel_rx_data <= mst2slv.writeData(7 downto 0);
+                    end if;
+                    if mst2slv.readReady = '1' and tunnel_enabled and not tx_queue_empty then
+                        tunnel_tx_pop <= true;
+                        slv2mst_internal.readData(7 downto 0) <= tx_queue_data_out;
+                        slv2mst_internal.readData(8) <= '1';
+                    end if;
+                end if;
             end if;
         end if;
     end process;
@@ -146,22 +178,22 @@ begin
     uart_bus_slave_writer : entity work.uart_bus_slave_writer
     port map (
         clk => clk,
-        reset => tx_reset_internal,
+        reset => tx_reset_internal or tunnel_enabled,
         half_baud_clk_ticks => '0' & baud_clk_ticks(31 downto 1),
         tx => tx,
         data_in => tx_queue_data_out,
         data_available => not tx_queue_empty,
-        data_pop => tx_queue_pop_data
+        data_pop => writer_pop_data
     );
 
     uart_bus_slave_reader : entity work.uart_bus_slave_reader
     port map (
         clk => clk,
-        reset => rx_reset_internal,
+        reset => rx_reset_internal or tunnel_enabled,
         half_baud_clk_ticks => '0' & baud_clk_ticks(31 downto 1),
         rx => rx,
-        data_out => rx_queue_data_in,
-        data_ready => rx_queue_push_data
+        data_out => reader_data_out,
+        data_ready => reader_data_ready
     );
 
     tx_queue : entity work.generic_fifo
@@ -0,0 +1,163 @@
+#include <stdbool.h>
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+
+#include "systemClock.h"
+#include "bubbleSort.h"
+#include "sort.h"
+
+// Results for the host, the mailbox is placed at the start of SRAM (0x120000) by the linker script.
+// Word 0: 0 while running, 1 when done. Written last.
+// Word 1: bitmask of benchmarks whose output was wrong, bit i for benchmark i.
+// Word 2 + i: clock cycles spent in benchmark i.
+enum benchmark {
+    BENCHMARK_BUBBLE_SORT,
+    BENCHMARK_INTRO_SORT,
+    BENCHMARK_RADIX_SORT,
+    BENCHMARK_BYTE_COPY,
+    BENCHMARK_MEMCPY_ALIGNED,
+    BENCHMARK_MEMCPY_UNALIGNED,
+    BENCHMARK_MEMMOVE_OVERLAPPING,
+    BENCHMARK_MEMSET,
+    BENCHMARK_COUNT
+};
+
+#define MAILBOX_SIZE (2 + BENCHMARK_COUNT)
+#define SORT_ELEMENTS 256
+#define COPY_BYTES 2048
+
+__attribute__((section(".mailbox"))) volatile uint32_t mailbox[MAILBOX_SIZE];
+
+static int32_t input[SORT_ELEMENTS];
+static int32_t work[SORT_ELEMENTS];
+static int32_t reference[SORT_ELEMENTS];
+static int32_t scratch[SORT_ELEMENTS];
+
+static uint8_t copySource[COPY_BYTES + 4];
+static uint8_t copyDest[COPY_BYTES + 4];
+
+static uint32_t xorshift32(uint32_t* state)
+{
+    uint32_t x = *state;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    *state = x;
+    return x;
+}
+
+static uint32_t cyclesSince(uint64_t start)
+{
+    return (uint32_t)(systemClock_getCycleCount() - start);
+}
+
+static void report(enum benchmark b, uint32_t cycles, bool correct)
+{
+    mailbox[2 + b] = cycles;
+    if (!correct) {
+        mailbox[1] |= 1u << b;
+    }
+}
+
+static bool isSorted(const int32_t arr[], size_t n)
+{
+    for (size_t i = 1; i < n; i++) {
+        if (arr[i - 1] > arr[i]) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static void runSortBenchmarks(void)
+{
+    uint64_t start;
+    uint32_t cycles;
+
+    memcpy(reference, input, sizeof(input));
+    start = systemClock_getCycleCount();
+    bubbleSort_int32(reference, SORT_ELEMENTS);
+    cycles = cyclesSince(start);
+    report(BENCHMARK_BUBBLE_SORT, cycles, isSorted(reference, SORT_ELEMENTS));
+
+    memcpy(work, input, sizeof(input));
+    start = systemClock_getCycleCount();
+    introSort_int32(work, SORT_ELEMENTS);
+    cycles = cyclesSince(start);
+    report(BENCHMARK_INTRO_SORT, cycles, memcmp(work, reference, sizeof(work)) == 0);
+
+    memcpy(work, input, sizeof(input));
+    start = systemClock_getCycleCount();
+    radixSort_int32(work, scratch, SORT_ELEMENTS);
+    cycles = cyclesSince(start);
+    report(BENCHMARK_RADIX_SORT, cycles, memcmp(work, reference, sizeof(work)) == 0);
+}
+
+static bool bytesMatch(const uint8_t a[], const uint8_t b[], size_t n)
+{
+    for (size_t i = 0; i < n; i++) {
+        if (a[i] != b[i]) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static void runMemoryBenchmarks(void)
+{
+    uint64_t start;
+    uint32_t cycles;
+    // Volatile keeps the compiler from turning this loop into a memcpy call
+    volatile uint8_t* byteDest = copyDest;
+
+    start = systemClock_getCycleCount();
+    for (size_t i = 0; i < COPY_BYTES; i++) {
+        byteDest[i] = copySource[i];
+    }
+    cycles = cyclesSince(start);
+    report(BENCHMARK_BYTE_COPY, cycles, bytesMatch(copyDest, copySource, COPY_BYTES));
+
+    start = systemClock_getCycleCount();
+    memcpy(copyDest, copySource, COPY_BYTES);
+    cycles = cyclesSince(start);
+    report(BENCHMARK_MEMCPY_ALIGNED, cycles, bytesMatch(copyDest, copySource, COPY_BYTES));
+
+    start = systemClock_getCycleCount();
+    memcpy(copyDest, &copySource[1], COPY_BYTES);
+    cycles = cyclesSince(start);
+    report(BENCHMARK_MEMCPY_UNALIGNED, cycles, bytesMatch(copyDest, &copySource[1], COPY_BYTES));
+
+    // copyDest holds copySource[1..], shifting it up by two bytes gives copySource[1..] at offset 2
+    start = systemClock_getCycleCount();
+    memmove(&copyDest[2], copyDest, COPY_BYTES);
+    cycles = cyclesSince(start);
+    report(BENCHMARK_MEMMOVE_OVERLAPPING, cycles, bytesMatch(&copyDest[2], &copySource[1], COPY_BYTES));
+
+    start = systemClock_getCycleCount();
+    memset(copyDest, 0xa5, COPY_BYTES);
+    cycles = cyclesSince(start);
+    bool correct = true;
+    for (size_t i = 0; i < COPY_BYTES; i++) {
+        correct = correct && copyDest[i] == 0xa5;
+    }
+    report(BENCHMARK_MEMSET, cycles, correct);
+}
+
+int main() {
+    uint32_t state = 0x12345678;
+    for (size_t i = 0; i < SORT_ELEMENTS; i++) {
+        input[i] = (int32_t)xorshift32(&state);
+    }
+    for (size_t i = 0; i < sizeof(copySource); i++) {
+        copySource[i] = (uint8_t)xorshift32(&state);
+    }
+    mailbox[1] = 0;
+
+    runSortBenchmarks();
+    runMemoryBenchmarks();
+
+    mailbox[0] = 1;
+    while (true);
+    return 0;
+}
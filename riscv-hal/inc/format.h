@@ -0,0 +1,10 @@
+#pragma once
+#include <stdint.h>
+#include <stddef.h>
+
+// Longest possible output, "-2147483648". No terminating zero is written.
+#define FORMAT_INT32_MAX_LENGTH 11
+
+// Both write the decimal representation of value to buf and return the number of characters written.
+size_t format_uint32(char buf[], uint32_t value);
+size_t format_int32(char buf[], int32_t value);
@@ -0,0 +1,8 @@
+#pragma once
+#include <stddef.h>
+
+// src/memRoutines.c replaces the newlib versions of these, the prototypes are the ones from string.h.
+// Word aligned data is moved a word per access, because every store goes to the bus through the write-through dcache.
+void* memcpy(void* restrict dest, const void* restrict src, size_t n);
+void* memmove(void* dest, const void* src, size_t n);
+void* memset(void* dest, int c, size_t n);
@@ -0,0 +1,11 @@
+#pragma once
+#include <stdint.h>
+#include <stddef.h>
+
+// Quicksort that falls back to heapsort when the recursion gets too deep and to insertion sort for short ranges.
+// In place, O(n log n) worst case.
+void introSort_int32(int32_t arr[], size_t n);
+
+// LSD radix sort on bytes. Needs a scratch array of n elements, passes in which all elements share the same byte
+// are skipped.
+void radixSort_int32(int32_t arr[], int32_t scratch[], size_t n);
@@ -1,3 +1,8 @@
 #pragma once
 
+#include <stdint.h>
+
 #define SYSTEM_CLOCK_FREQUENCY_HZ 100000000
+
+// Clock cycles since the last reset of the system, read from the processor control registers.
+uint64_t systemClock_getCycleCount(void);
@@ -1,9 +1,23 @@
 #pragma once
 
+#include <stddef.h>
 #include <stdint.h>
 
 void uart_init(uint32_t baudrate);
 
 uint8_t uart_getCharBlocking(void);
 
+// Waits until the character, and everything buffered before it, is accepted by the hardware.
 void uart_putCharBlocking(uint8_t);
+
+// Buffered output. These only block when the RAM buffer is full, the buffer is moved to the hardware by uart_poll.
+// uart_getCharBlocking and uart_flush poll as well, long running code without either should call uart_poll itself
+// every now and then.
+void uart_putChar(uint8_t);
+void uart_write(const char* buf, size_t len);
+
+// Moves as much data as possible between the RAM buffers and the hardware queues, without waiting.
+void uart_poll(void);
+
+// Waits until the output buffer is empty.
+void uart_flush(void);
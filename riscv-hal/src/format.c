@@ -0,0 +1,35 @@
+#include <stdint.h>
+#include <stddef.h>
+
+#include "format.h"
+
+// rv32i has neither a divider nor a multiplier, so every digit is found by repeated subtraction instead.
+static const uint32_t powersOfTen[] = {
+    1000000000, 100000000, 10000000, 1000000, 100000, 10000, 1000, 100, 10, 1
+};
+
+size_t format_uint32(char buf[], uint32_t value)
+{
+    const size_t powerCount = sizeof(powersOfTen)/sizeof(powersOfTen[0]);
+    size_t len = 0;
+    for (size_t i = 0; i < powerCount; i++) {
+        char digit = '0';
+        while (value >= powersOfTen[i]) {
+            value -= powersOfTen[i];
+            digit++;
+        }
+        if (digit != '0' || len > 0 || i == powerCount - 1) {
+            buf[len++] = digit;
+        }
+    }
+    return len;
+}
+
+size_t format_int32(char buf[], int32_t value)
+{
+    if (value < 0) {
+        buf[0] = '-';
+        return 1 + format_uint32(&buf[1], -(uint32_t)value);
+    }
+    return format_uint32(buf, value);
+}
@@ -1,26 +1,22 @@
-#define _GNU_SOURCE
 #include <stdbool.h>
 #include <stdlib.h>
-#include <stdio.h>
 #include <string.h>
 #include <inttypes.h>
 
 #include "uart.h"
-#include "bubbleSort.h"
+#include "format.h"
+#include "systemClock.h"
+#include "sort.h"
 
-static void writeString(char* buf) {
-    while(*buf != 0) {
-        uart_putCharBlocking(*buf);
-        buf++;
-    }
+static void writeString(const char* buf) {
+    uart_write(buf, strlen(buf));
 }
 
 static void writeEndl(void) {
-    uart_putCharBlocking('\r');
-    uart_putCharBlocking('\n');
+    uart_write("\r\n", 2);
 }
 
-static void writeStringAndEndl(char* buf) {
+static void writeStringAndEndl(const char* buf) {
     writeString(buf);
     writeEndl();
 }
@@ -38,7 +34,7 @@ static void readStringFromUart(char** b) {
         if (byte == '\r'){
             writeEndl();
         } else {
-            uart_putCharBlocking(byte);
+            uart_putChar(byte);
         }
         if ((byte >= '0' && byte <= '9') || byte == ',' || byte == '\r' || byte == '-') {
             if (index == curSize - 1) {
@@ -114,19 +110,23 @@ static size_t parseNumbers(const char* buf, int32_t** out) {
 }
 
 static void printNumbers(const int32_t* arr, size_t arrlen) {
-    char* writeBuf = NULL;
+    char writeBuf[FORMAT_INT32_MAX_LENGTH + 2];
     for (size_t i = 0; i < arrlen - 1; ++i) {
-        asprintf(&writeBuf, "%" PRId32 ", ", arr[i]);
-        if (writeBuf != NULL) {
-            writeString(writeBuf);
-            free(writeBuf);
-            writeBuf = NULL;
-        }
+        size_t len = format_int32(writeBuf, arr[i]);
+        writeBuf[len++] = ',';
+        writeBuf[len++] = ' ';
+        uart_write(writeBuf, len);
     }
-    asprintf(&writeBuf, "%" PRId32, arr[arrlen - 1]);
-    writeStringAndEndl(writeBuf);
-    free(writeBuf);
-    writeBuf = NULL;
+    size_t len = format_int32(writeBuf, arr[arrlen - 1]);
+    uart_write(writeBuf, len);
+    writeEndl();
+}
+
+static void writeCount(const char* prefix, uint32_t count, const char* suffix) {
+    char writeBuf[FORMAT_INT32_MAX_LENGTH];
+    writeString(prefix);
+    uart_write(writeBuf, format_uint32(writeBuf, count));
+    writeStringAndEndl(suffix);
 }
 
 int main() {
@@ -139,19 +139,19 @@ int main() {
             if (buf[0] != 0) {
                 int32_t *numbers = NULL;
                 size_t numCount = parseNumbers(buf, &numbers);
-                char* writeBuf = NULL;
-                asprintf(&writeBuf, "There are %zu numbers in this string", numCount);
-                if (writeBuf != NULL) {
-                    writeStringAndEndl(writeBuf);
-                    free(writeBuf);
-                    writeBuf = NULL;
-                }
+                writeCount("There are ", numCount, " numbers in this string");
                 if (numbers != NULL && numCount > 0) {
                     writeStringAndEndl("Your numbers are:");
                     printNumbers(numbers, numCount);
-                    bubbleSort_int32(numbers, numCount);
+                    uint64_t start = systemClock_getCycleCount();
+                    introSort_int32(numbers, numCount);
+                    uint64_t sortCycles = systemClock_getCycleCount() - start;
                     writeStringAndEndl("Your numbers, but sorted are:");
+                    start = systemClock_getCycleCount();
                     printNumbers(numbers, numCount);
+                    uint64_t printCycles = systemClock_getCycleCount() - start;
+                    writeCount("Sorting took ", (uint32_t)sortCycles, " cycles");
+                    writeCount("Printing took ", (uint32_t)printCycles, " cycles");
                 }
             } else {
                 writeStringAndEndl("There were no numbers in this string");
@@ -0,0 +1,174 @@
+#include <stdint.h>
+#include <stddef.h>
+
+#include "memRoutines.h"
+
+// Words moved per iteration of the unrolled loops
+#define UNROLL_WORDS 8
+
+static void copyBytesForward(uint8_t* d, const uint8_t* s, size_t n)
+{
+    while (n > 0) {
+        *d++ = *s++;
+        n--;
+    }
+}
+
+// Also used by memmove when dest is below src, so no restrict and every block is read before it is written.
+static void copyForward(uint8_t* d, const uint8_t* s, size_t n)
+{
+    if (n < 2*sizeof(uint32_t)) {
+        copyBytesForward(d, s, n);
+        return;
+    }
+    while (((uintptr_t)d & 3) != 0) {
+        *d++ = *s++;
+        n--;
+    }
+    uint32_t* dw = (uint32_t*)d;
+    size_t offset = (uintptr_t)s & 3;
+    if (offset == 0) {
+        const uint32_t* sw = (const uint32_t*)s;
+        while (n >= UNROLL_WORDS*sizeof(uint32_t)) {
+            uint32_t w0 = sw[0];
+            uint32_t w1 = sw[1];
+            uint32_t w2 = sw[2];
+            uint32_t w3 = sw[3];
+            uint32_t w4 = sw[4];
+            uint32_t w5 = sw[5];
+            uint32_t w6 = sw[6];
+            uint32_t w7 = sw[7];
+            dw[0] = w0;
+            dw[1] = w1;
+            dw[2] = w2;
+            dw[3] = w3;
+            dw[4] = w4;
+            dw[5] = w5;
+            dw[6] = w6;
+            dw[7] = w7;
+            sw += UNROLL_WORDS;
+            dw += UNROLL_WORDS;
+            n -= UNROLL_WORDS*sizeof(uint32_t);
+        }
+        while (n >= sizeof(uint32_t)) {
+            *dw++ = *sw++;
+            n -= sizeof(uint32_t);
+        }
+        s = (const uint8_t*)sw;
+    } else {
+        // rv32i has no misaligned loads, so merge two aligned source words per destination word (little endian).
+        const uint32_t* sw = (const uint32_t*)(s - offset);
+        unsigned shiftRight = offset*8;
+        unsigned shiftLeft = 32 - shiftRight;
+        uint32_t current = *sw++;
+        while (n >= sizeof(uint32_t)) {
+            uint32_t next = *sw++;
+            *dw++ = (current >> shiftRight) | (next << shiftLeft);
+            current = next;
+            n -= sizeof(uint32_t);
+        }
+        s = (const uint8_t*)sw - sizeof(uint32_t) + offset;
+    }
+    copyBytesForward((uint8_t*)dw, s, n);
+}
+
+// d and s point one past the end of their ranges
+static void copyBackward(uint8_t* d, const uint8_t* s, size_t n)
+{
+    if (n >= 2*sizeof(uint32_t) && (((uintptr_t)d ^ (uintptr_t)s) & 3) == 0) {
+        while (((uintptr_t)d & 3) != 0) {
+            *--d = *--s;
+            n--;
+        }
+        uint32_t* dw = (uint32_t*)d;
+        const uint32_t* sw = (const uint32_t*)s;
+        while (n >= UNROLL_WORDS*sizeof(uint32_t)) {
+            sw -= UNROLL_WORDS;
+            dw -= UNROLL_WORDS;
+            uint32_t w7 = sw[7];
+            uint32_t w6 = sw[6];
+            uint32_t w5 = sw[5];
+            uint32_t w4 = sw[4];
+            uint32_t w3 = sw[3];
+            uint32_t w2 = sw[2];
+            uint32_t w1 = sw[1];
+            uint32_t w0 = sw[0];
+            dw[7] = w7;
+            dw[6] = w6;
+            dw[5] = w5;
+            dw[4] = w4;
+            dw[3] = w3;
+            dw[2] = w2;
+            dw[1] = w1;
+            dw[0] = w0;
+            n -= UNROLL_WORDS*sizeof(uint32_t);
+        }
+        while (n >= sizeof(uint32_t)) {
+            *--dw = *--sw;
+            n -= sizeof(uint32_t);
+        }
+        d = (uint8_t*)dw;
+        s = (const uint8_t*)sw;
+    }
+    while (n > 0) {
+        *--d = *--s;
+        n--;
+    }
+}
+
+void* memcpy(void* restrict dest, const void* restrict src, size_t n)
+{
+    copyForward(dest, src, n);
+    return dest;
+}
+
+void* memmove(void* dest, const void* src, size_t n)
+{
+    uint8_t* d = dest;
+    const uint8_t* s = src;
+    if (d <= s || d >= s + n) {
+        copyForward(d, s, n);
+    } else {
+        copyBackward(d + n, s + n, n);
+    }
+    return dest;
+}
+
+void* memset(void* dest, int c, size_t n)
+{
+    uint8_t* d = dest;
+    uint8_t value = (uint8_t)c;
+    if (n >= 2*sizeof(uint32_t)) {
+        while (((uintptr_t)d & 3) != 0) {
+            *d++ = value;
+            n--;
+        }
+        // Shifts instead of a multiplication by 0x01010101, rv32i has no multiplier
+        uint32_t pattern = value;
+        pattern |= pattern << 8;
+        pattern |= pattern << 16;
+        uint32_t* dw = (uint32_t*)d;
+        while (n >= UNROLL_WORDS*sizeof(uint32_t)) {
+            dw[0] = pattern;
+            dw[1] = pattern;
+            dw[2] = pattern;
+            dw[3] = pattern;
+            dw[4] = pattern;
+            dw[5] = pattern;
+            dw[6] = pattern;
+            dw[7] = pattern;
+            dw += UNROLL_WORDS;
+            n -= UNROLL_WORDS*sizeof(uint32_t);
+        }
+        while (n >= sizeof(uint32_t)) {
+            *dw++ = pattern;
+            n -= sizeof(uint32_t);
+        }
+        d = (uint8_t*)dw;
+    }
+    while (n > 0) {
+        *d++ = value;
+        n--;
+    }
+    return dest;
+}
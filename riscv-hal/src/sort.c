@@ -0,0 +1,155 @@
+#include <stdbool.h>
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+
+#include "sort.h"
+
+// Below this size insertion sort beats partitioning
+#define INSERTION_SORT_THRESHOLD 16
+#define RADIX_BITS 8
+#define RADIX_BUCKETS (1 << RADIX_BITS)
+
+static void swap_int32(int32_t* xp, int32_t* yp)
+{
+    int32_t temp = *xp;
+    *xp = *yp;
+    *yp = temp;
+}
+
+static void insertionSort_int32(int32_t arr[], size_t n)
+{
+    for (size_t i = 1; i < n; i++) {
+        int32_t value = arr[i];
+        size_t j = i;
+        while (j > 0 && arr[j - 1] > value) {
+            arr[j] = arr[j - 1];
+            j--;
+        }
+        arr[j] = value;
+    }
+}
+
+static void siftDown_int32(int32_t arr[], size_t root, size_t n)
+{
+    int32_t value = arr[root];
+    while (true) {
+        size_t child = 2*root + 1;
+        if (child >= n) {
+            break;
+        }
+        if (child + 1 < n && arr[child + 1] > arr[child]) {
+            child++;
+        }
+        if (arr[child] <= value) {
+            break;
+        }
+        arr[root] = arr[child];
+        root = child;
+    }
+    arr[root] = value;
+}
+
+static void heapSort_int32(int32_t arr[], size_t n)
+{
+    for (size_t i = n/2; i > 0; i--) {
+        siftDown_int32(arr, i - 1, n);
+    }
+    for (size_t i = n - 1; i > 0; i--) {
+        swap_int32(&arr[0], &arr[i]);
+        siftDown_int32(arr, 0, i);
+    }
+}
+
+// Sorts the first, middle and last element and returns the median, which then also guards both partition scans.
+static int32_t medianOfThree_int32(int32_t arr[], size_t n)
+{
+    size_t mid = n/2;
+    if (arr[mid] < arr[0]) {
+        swap_int32(&arr[mid], &arr[0]);
+    }
+    if (arr[n - 1] < arr[0]) {
+        swap_int32(&arr[n - 1], &arr[0]);
+    }
+    if (arr[n - 1] < arr[mid]) {
+        swap_int32(&arr[n - 1], &arr[mid]);
+    }
+    return arr[mid];
+}
+
+static void introSortLoop_int32(int32_t arr[], size_t n, unsigned depthLimit)
+{
+    while (n > INSERTION_SORT_THRESHOLD) {
+        if (depthLimit == 0) {
+            heapSort_int32(arr, n);
+            return;
+        }
+        depthLimit--;
+        int32_t pivot = medianOfThree_int32(arr, n);
+        size_t i = 0;
+        size_t j = n - 1;
+        while (true) {
+            do {
+                i++;
+            } while (arr[i] < pivot);
+            do {
+                j--;
+            } while (arr[j] > pivot);
+            if (i >= j) {
+                break;
+            }
+            swap_int32(&arr[i], &arr[j]);
+        }
+        // Recurse into the smaller half, loop on the larger one to bound the stack
+        size_t leftSize = j + 1;
+        if (leftSize < n - leftSize) {
+            introSortLoop_int32(arr, leftSize, depthLimit);
+            arr += leftSize;
+            n -= leftSize;
+        } else {
+            introSortLoop_int32(arr + leftSize, n - leftSize, depthLimit);
+            n = leftSize;
+        }
+    }
+    insertionSort_int32(arr, n);
+}
+
+void introSort_int32(int32_t arr[], size_t n)
+{
+    unsigned depthLimit = 0;
+    for (size_t i = n; i > 1; i >>= 1) {
+        depthLimit += 2;
+    }
+    introSortLoop_int32(arr, n, depthLimit);
+}
+
+void radixSort_int32(int32_t arr[], int32_t scratch[], size_t n)
+{
+    uint32_t* src = (uint32_t*)arr;
+    uint32_t* dst = (uint32_t*)scratch;
+    for (unsigned shift = 0; shift < 32; shift += RADIX_BITS) {
+        size_t buckets[RADIX_BUCKETS] = {0};
+        // Flipping the sign bit makes the signed order match the unsigned order
+        for (size_t i = 0; i < n; i++) {
+            buckets[((src[i] ^ 0x80000000) >> shift) & (RADIX_BUCKETS - 1)]++;
+        }
+        if (n == 0 || buckets[((src[0] ^ 0x80000000) >> shift) & (RADIX_BUCKETS - 1)] == n) {
+            continue;
+        }
+        size_t offset = 0;
+        for (size_t b = 0; b < RADIX_BUCKETS; b++) {
+            size_t count = buckets[b];
+            buckets[b] = offset;
+            offset += count;
+        }
+        for (size_t i = 0; i < n; i++) {
+            dst[buckets[((src[i] ^ 0x80000000) >> shift) & (RADIX_BUCKETS - 1)]++] = src[i];
+        }
+        uint32_t* tmp = src;
+        src = dst;
+        dst = tmp;
+    }
+    if (src != (uint32_t*)arr) {
+        memcpy(arr, src, n*sizeof(arr[0]));
+    }
+}
@@ -0,0 +1,17 @@
+#include <stdint.h>
+
+#include "systemClock.h"
+
+static volatile uint32_t* const cycleCountLow = (volatile uint32_t*)0x2008;
+static volatile uint32_t* const cycleCountHigh = (volatile uint32_t*)0x200c;
+
+uint64_t systemClock_getCycleCount(void) {
+    uint32_t high;
+    uint32_t low;
+    // The low word might overflow between the two reads
+    do {
+        high = *cycleCountHigh;
+        low = *cycleCountLow;
+    } while (high != *cycleCountHigh);
+    return ((uint64_t)high << 32) | low;
+}
@@ -5,17 +5,30 @@
 
 static const uint16_t MAX_QUEUE_SIZE = 16;
 
+// Both must be a power of two
+#define TX_BUFFER_SIZE 1024
+#define RX_BUFFER_SIZE 256
+
 static volatile uint8_t* const txQueue = (volatile uint8_t*)0x1000;
 static volatile uint8_t* const rxQueue = (volatile uint8_t*)0x1002;
 
 static volatile uint8_t* const txEnable = (volatile uint8_t*)0x1001;
 static volatile uint8_t* const rxEnable = (volatile uint8_t*)0x1003;
 
-static volatile uint16_t* const txQueueCount = (volatile uint16_t*)0x1004;
-static volatile uint16_t* const rxQueueCount = (volatile uint16_t*)0x1006;
+// txQueueCount in the lower half, rxQueueCount in the upper half. Read as one, to save a bus access.
+static volatile uint32_t* const queueCounts = (volatile uint32_t*)0x1004;
 
 static volatile uint32_t* const baudDivisor = (volatile uint32_t*)0x1008;
 
+// The indices run freely, only their difference and their lower bits matter.
+static uint8_t txBuffer[TX_BUFFER_SIZE];
+static uint32_t txHead = 0;
+static uint32_t txTail = 0;
+
+static uint8_t rxBuffer[RX_BUFFER_SIZE];
+static uint32_t rxHead = 0;
+static uint32_t rxTail = 0;
+
 void uart_init(uint32_t baudrate) {
     *txEnable = 0;
     *rxEnable = 0;
@@ -24,13 +37,56 @@ void uart_init(uint32_t baudrate) {
     *rxEnable = 1;
 }
 
+void uart_poll(void) {
+    uint32_t counts = *queueCounts;
+    uint16_t txSpace = MAX_QUEUE_SIZE - (uint16_t)(counts & 0xffff);
+    uint16_t rxAvailable = (uint16_t)(counts >> 16);
+    while (txSpace > 0 && txTail != txHead) {
+        *txQueue = txBuffer[txTail % TX_BUFFER_SIZE];
+        txTail++;
+        txSpace--;
+    }
+    while (rxAvailable > 0 && rxHead - rxTail < RX_BUFFER_SIZE) {
+        rxBuffer[rxHead % RX_BUFFER_SIZE] = *rxQueue;
+        rxHead++;
+        rxAvailable--;
+    }
+}
+
+void uart_flush(void) {
+    while (txTail != txHead) {
+        uart_poll();
+    }
+}
 
 uint8_t uart_getCharBlocking(void) {
-    while(*rxQueueCount == 0);
-    return *rxQueue;
+    while (rxTail == rxHead) {
+        uart_poll();
+    }
+    uint8_t data = rxBuffer[rxTail % RX_BUFFER_SIZE];
+    rxTail++;
+    return data;
+}
+
+void uart_putChar(uint8_t data) {
+    while (txHead - txTail == TX_BUFFER_SIZE) {
+        uart_poll();
+    }
+    txBuffer[txHead % TX_BUFFER_SIZE] = data;
+    txHead++;
+    // Hand over in batches, so that the queue counts are not read for every character.
+    if (txHead - txTail >= MAX_QUEUE_SIZE) {
+        uart_poll();
+    }
+}
+
+void uart_write(const char* buf, size_t len) {
+    for (size_t i = 0; i < len; ++i) {
+        uart_putChar(buf[i]);
+    }
 }
 
 void uart_putCharBlocking(uint8_t data) {
-    while(*txQueueCount >= MAX_QUEUE_SIZE);
-    *txQueue = data;
+    uart_putChar(data);
+    uart_flush();
 }
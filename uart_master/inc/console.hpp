@@ -0,0 +1,10 @@
+#pragma once
+
+#include "deppUartMaster.hpp"
+
+// Tunnels the console of the firmware, which normally lives on the bus UART slave, over the bus master link.
+// The tunnel of the UART slave is enabled for the duration, so its queues are served by the host instead of the
+// physical UART. The output of the firmware goes to stdout, stdin goes to the firmware.
+// On a terminal, Ctrl-] quits. Ctrl-C is passed on to the firmware like any other byte. Otherwise the console quits
+// once stdin is closed and nothing has moved for a while.
+int runConsole(DeppUartMaster& master);
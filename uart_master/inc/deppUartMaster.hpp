@@ -19,6 +19,9 @@ class DeppUartMaster {
         void writeWordSequence(uint32_t address, const std::vector<uint32_t>& data);
         uint32_t readWord(uint32_t address);
         std::vector<uint32_t> readWordSequence(uint32_t address, size_t wordCount);
+        // Access the same address over and over, as needed for FIFO registers. Requests are pipelined.
+        void writeWordRepeated(uint32_t address, const std::vector<uint32_t>& data);
+        std::vector<uint32_t> readWordRepeated(uint32_t address, size_t count);
         void selfTest();
     private:
         int fd;
@@ -26,10 +29,13 @@ class DeppUartMaster {
 
         void writeByte(uint8_t data);
         void writeWord(uint32_t data);
+        void writeRequest(uint8_t command, uint32_t address);
         void writeArray(const uint8_t* data, size_t len);
 
         uint8_t readByte();
         uint32_t readWord();
         void readArray(uint8_t* data, size_t len);
         void checkReturnValue();
+        // Reads a return value and keeps it in firstError, unless an earlier one already failed.
+        void collectReturnValue(uint8_t& firstError);
 };
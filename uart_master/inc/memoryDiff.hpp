@@ -0,0 +1,19 @@
+#pragma once
+
+#include <cstdint>
+#include <ostream>
+#include <vector>
+
+#include "memoryImage.hpp"
+
+struct MemoryDiffRegion {
+    uint32_t address;
+    size_t wordCount;
+    uint32_t firstExpected;
+    uint32_t firstActual;
+};
+
+// Compares the words that are valid in both images, over the address range the images have in common.
+std::vector<MemoryDiffRegion> diffImages(const MemoryImage& expected, const MemoryImage& actual);
+
+void printDiff(std::ostream& os, const std::vector<MemoryDiffRegion>& regions, const std::vector<MemorySymbol>& symbols);
@@ -0,0 +1,32 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "deppUartMaster.hpp"
+
+// A word addressed view of a memory range. Words that are not known, for example gaps between ELF segments, have
+// valid set to 0 and are ignored when diffing.
+struct MemoryImage {
+    uint32_t baseAddress;
+    std::vector<uint32_t> words;
+    std::vector<uint8_t> valid;
+};
+
+struct MemorySymbol {
+    uint32_t address;
+    uint32_t size;
+    std::string name;
+};
+
+MemoryImage captureImage(DeppUartMaster& master, uint32_t address, size_t wordCount);
+
+// Snapshot files store only the pages that contain a nonzero word, see memoryImage.cpp for the layout.
+void writeSnapshot(const std::string& filename, const MemoryImage& image);
+MemoryImage readSnapshot(const std::string& filename);
+bool isSnapshot(const std::string& filename);
+
+// Builds the image as it is uploaded to the device, so every loadable segment at its load address.
+MemoryImage readElfImage(const std::string& filename, uint32_t baseAddress, size_t wordCount);
+std::vector<MemorySymbol> readElfSymbols(const std::string& filename);
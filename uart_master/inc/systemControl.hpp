@@ -0,0 +1,18 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "deppUartMaster.hpp"
+
+static constexpr uint32_t spiMemStartAddress = 0x100000;
+static constexpr uint32_t spiMemLength = 0x60000;
+static constexpr uint32_t cpuBaseAddress = 0x2000;
+static constexpr uint32_t uartSlaveQueueCountAddress = 0x1004;
+static constexpr uint32_t uartSlaveTunnelAddress = 0x100c;
+static constexpr size_t uartSlaveQueueSize = 16;
+
+void writeImage(DeppUartMaster& master, const std::vector<uint32_t>& data, uint32_t startAddress);
+bool verifyImage(DeppUartMaster& master, const std::vector<uint32_t>& data, uint32_t startAddress);
+void startProcessor(DeppUartMaster& master);
+void stopProcessor(DeppUartMaster& master);
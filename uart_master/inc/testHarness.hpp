@@ -0,0 +1,50 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "deppUartMaster.hpp"
+
+// A manifest is a text file with one statement per line, empty lines and lines starting with # are ignored.
+// Numbers are accepted in any base strtoul understands, so 0x prefixes work.
+//
+//   test <name> <image path> <timeout in ms>
+//   mailbox <address> <word count>
+//   expect <address> <word> [<word> ...]
+//
+// mailbox and expect belong to the last test statement. Every test needs a mailbox. The harness clears the mailbox
+// before it starts the CPU and considers the program finished once the first mailbox word is nonzero.
+// Expectations that lie within the mailbox are checked against the final poll, others are read separately.
+
+struct HarnessExpectation {
+    uint32_t address;
+    std::vector<uint32_t> data;
+};
+
+struct HarnessTest {
+    std::string name;
+    std::string imagePath;
+    unsigned timeoutMs;
+    uint32_t mailboxAddress;
+    size_t mailboxWordCount;
+    std::vector<HarnessExpectation> expectations;
+};
+
+enum class HarnessOutcome {
+    pass,
+    fail,
+    timeout,
+    error
+};
+
+struct HarnessResult {
+    std::string name;
+    HarnessOutcome outcome;
+    std::string message;
+    double durationSeconds;
+};
+
+std::vector<HarnessTest> readManifest(const std::string& filename);
+
+std::vector<HarnessResult> runHarness(DeppUartMaster& master, const std::vector<HarnessTest>& tests);
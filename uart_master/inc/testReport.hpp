@@ -0,0 +1,9 @@
+#pragma once
+
+#include <ostream>
+#include <vector>
+
+#include "testHarness.hpp"
+
+void writeJUnitReport(std::ostream& os, const std::vector<HarnessResult>& results);
+void writeJsonReport(std::ostream& os, const std::vector<HarnessResult>& results);
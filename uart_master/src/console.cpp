@@ -0,0 +1,152 @@
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <deque>
+#include <stdexcept>
+#include <poll.h>
+#include <termios.h>
+#include <unistd.h>
+
+#include "console.hpp"
+#include "systemControl.hpp"
+
+static constexpr uint32_t tunnelEnable = 1 << 16;
+static constexpr uint32_t tunnelDataValid = 1 << 8;
+static constexpr uint8_t quitCharacter = 0x1d;
+static constexpr int maxPollIntervalMs = 50;
+static constexpr auto quietTimeout = std::chrono::milliseconds(500);
+// Input the firmware does not pick up is buffered up to this size, the rest is dropped.
+static constexpr size_t maxPending = 4096;
+
+namespace {
+    class RawTerminal {
+        public:
+            RawTerminal() {
+                active = isatty(STDIN_FILENO) && tcgetattr(STDIN_FILENO, &oldSettings) == 0;
+                if (active) {
+                    struct termios tty = oldSettings;
+                    cfmakeraw(&tty);
+                    tcsetattr(STDIN_FILENO, TCSANOW, &tty);
+                }
+            }
+
+            RawTerminal(const RawTerminal&) = delete;
+            RawTerminal& operator=(const RawTerminal&) = delete;
+
+            ~RawTerminal() {
+                if (active) {
+                    tcsetattr(STDIN_FILENO, TCSANOW, &oldSettings);
+                }
+            }
+
+            bool isInteractive() const {
+                return active;
+            }
+        private:
+            bool active;
+            struct termios oldSettings;
+    };
+
+    // Hands the queues of the UART slave back to the physical UART, also when the console ends with an exception.
+    class Tunnel {
+        public:
+            Tunnel(DeppUartMaster& master) : master(master) {
+                master.writeWord(uartSlaveTunnelAddress, tunnelEnable);
+            }
+
+            Tunnel(const Tunnel&) = delete;
+            Tunnel& operator=(const Tunnel&) = delete;
+
+            ~Tunnel() {
+                try {
+                    master.writeWord(uartSlaveTunnelAddress, 0);
+                } catch (const std::exception&) {
+                    // The link is gone, nothing left to clean up on the other side
+                }
+            }
+        private:
+            DeppUartMaster& master;
+    };
+}
+
+static void writeAll(int fd, const uint8_t* data, size_t len) {
+    while (len > 0) {
+        ssize_t retVal = write(fd, data, len);
+        if (retVal <= 0) {
+            return;
+        }
+        data += retVal;
+        len -= retVal;
+    }
+}
+
+int runConsole(DeppUartMaster& master) {
+    RawTerminal terminal;
+    std::deque<uint8_t> pending;
+    bool stdinOpen = true;
+    bool quit = false;
+    int pollIntervalMs = 0;
+    auto lastActivity = std::chrono::steady_clock::now();
+    Tunnel tunnel(master);
+    while (!quit) {
+        bool active = false;
+        uint32_t counts = master.readWord(uartSlaveQueueCountAddress);
+        size_t txCount = counts & 0xffff;
+        size_t rxCount = counts >> 16;
+
+        if (txCount > 0) {
+            std::vector<uint8_t> output;
+            for (uint32_t word : master.readWordRepeated(uartSlaveTunnelAddress, txCount)) {
+                if (word & tunnelDataValid) {
+                    output.push_back(word & 0xff);
+                }
+            }
+            writeAll(STDOUT_FILENO, output.data(), output.size());
+            active = true;
+        }
+
+        if (!pending.empty() && rxCount < uartSlaveQueueSize) {
+            size_t count = std::min(pending.size(), uartSlaveQueueSize - rxCount);
+            std::vector<uint32_t> words;
+            for (size_t i = 0; i < count; ++i) {
+                words.push_back(tunnelEnable | tunnelDataValid | pending.front());
+                pending.pop_front();
+            }
+            master.writeWordRepeated(uartSlaveTunnelAddress, words);
+            active = true;
+        }
+
+        // Back off while nothing moves, which includes input waiting on a firmware that does not read it.
+        if (active) {
+            pollIntervalMs = 0;
+            lastActivity = std::chrono::steady_clock::now();
+        } else {
+            pollIntervalMs = std::min(std::max(1, pollIntervalMs*2), maxPollIntervalMs);
+        }
+        if (stdinOpen) {
+            // Always read stdin, so that the quit character is seen even when the firmware stopped reading
+            struct pollfd pfd = {.fd = STDIN_FILENO, .events = POLLIN, .revents = 0};
+            if (poll(&pfd, 1, pollIntervalMs) > 0) {
+                uint8_t buf[64];
+                ssize_t retVal = read(STDIN_FILENO, buf, sizeof(buf));
+                if (retVal <= 0) {
+                    stdinOpen = false;
+                }
+                for (ssize_t i = 0; i < retVal; ++i) {
+                    if (terminal.isInteractive() && buf[i] == quitCharacter) {
+                        quit = true;
+                        break;
+                    }
+                    if (pending.size() < maxPending) {
+                        pending.push_back(buf[i]);
+                    }
+                }
+                pollIntervalMs = 0;
+            }
+        } else {
+            quit = std::chrono::steady_clock::now() - lastActivity > quietTimeout;
+            usleep(pollIntervalMs*1000);
+        }
+    }
+    return EXIT_SUCCESS;
+}
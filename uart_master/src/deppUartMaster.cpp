@@ -50,15 +50,19 @@ DeppUartMaster::DeppUartMaster(const std::string& devName, speed_t baudRate) {
 
     struct serial_struct serial;
     if (ioctl(fd, TIOCGSERIAL, &serial) == -1) {
-        std::stringstream ss;
-        ss << "ioctl TIOCGSERIAL failed: " << errno << " (" << strerror(errno) << ")";
-        throw std::runtime_error(ss.str());
-    }
-    serial.flags |= ASYNC_LOW_LATENCY;
-    if (ioctl(fd, TIOCSSERIAL, &serial) == -1) {
-        std::stringstream ss;
-        ss << "ioctl TIOCSSERIAL failed: " << errno << " (" << strerror(errno) << ")";
-        throw std::runtime_error(ss.str());
+        // A pseudo terminal, like the one created by the GHDL cosimulation, has no serial settings to tune.
+        if (errno != ENOTTY && errno != EINVAL) {
+            std::stringstream ss;
+            ss << "ioctl TIOCGSERIAL failed: " << errno << " (" << strerror(errno) << ")";
+            throw std::runtime_error(ss.str());
+        }
+    } else {
+        serial.flags |= ASYNC_LOW_LATENCY;
+        if (ioctl(fd, TIOCSSERIAL, &serial) == -1) {
+            std::stringstream ss;
+            ss << "ioctl TIOCSSERIAL failed: " << errno << " (" << strerror(errno) << ")";
+            throw std::runtime_error(ss.str());
+        }
     }
 
     if (tcflush(this->fd, TCIOFLUSH) == -1) {
@@ -111,8 +115,7 @@ uint8_t DeppUartMaster::readByte() {
     return ret;
 }
 
-void DeppUartMaster::checkReturnValue() {
-    uint8_t retVal = this->readByte();
+static void throwOnReturnValue(uint8_t retVal) {
     if (retVal != ERROR_NO_ERROR) {
         std::stringstream ss;
         ss << "Return value is something other than ERROR_NO_ERROR: " << (int)retVal;
@@ -120,6 +123,25 @@ void DeppUartMaster::checkReturnValue() {
     }
 }
 
+void DeppUartMaster::checkReturnValue() {
+    throwOnReturnValue(this->readByte());
+}
+
+void DeppUartMaster::collectReturnValue(uint8_t& firstError) {
+    uint8_t retVal = this->readByte();
+    if (firstError == ERROR_NO_ERROR) {
+        firstError = retVal;
+    }
+}
+
+static uint32_t decodeWord(const uint8_t* buf) {
+    uint32_t retVal = buf[0];
+    retVal += static_cast<uint32_t>(buf[1]) << 8;
+    retVal += static_cast<uint32_t>(buf[2]) << 16;
+    retVal += static_cast<uint32_t>(buf[3]) << 24;
+    return retVal;
+}
+
 void DeppUartMaster::writeWord(uint32_t data) {
     uint8_t buf[4];
     for (size_t i = 0; i < 4; ++i) {
@@ -132,11 +154,16 @@ void DeppUartMaster::writeWord(uint32_t data) {
 uint32_t DeppUartMaster::readWord() {
     uint8_t buf[4];
     this->readArray(&buf[0], 4);
-    uint32_t retVal = buf[0];
-    retVal += static_cast<uint32_t>(buf[1]) << 8;
-    retVal += static_cast<uint32_t>(buf[2]) << 16;
-    retVal += static_cast<uint32_t>(buf[3]) << 24;
-    return retVal;
+    return decodeWord(&buf[0]);
+}
+
+void DeppUartMaster::writeRequest(uint8_t command, uint32_t address) {
+    uint8_t request[5] = {command};
+    for (size_t i = 1; i < 5; ++i) {
+        request[i] = static_cast<uint8_t>(address & 0xff);
+        address >>= 8;
+    }
+    this->writeArray(&request[0], sizeof(request));
 }
 
 void DeppUartMaster::writeWord(uint32_t address, uint32_t data) {
@@ -175,22 +202,89 @@ void DeppUartMaster::writeWordSequence(uint32_t address, const std::vector<uint3
 }
 
 std::vector<uint32_t> DeppUartMaster::readWordSequence(uint32_t address, size_t wordCount) {
+    // The next request is sent before the current one is answered, so that the link does not idle for a round trip
+    // between sequences. A request is 6 bytes and the input queue of the bus master holds 16.
+    // A bus error is only reported once the answers to all requests in flight are consumed, so that the link stays in
+    // sync. A command that is not acknowledged means the link already is out of sync, that is reported right away.
+    static constexpr size_t maxRequestsInFlight = 2;
     std::vector<uint32_t> returnList(wordCount);
+    std::vector<uint8_t> buf(256*4);
+    size_t wordsRequested = 0;
     size_t wordsReceived = 0;
+    size_t requestsInFlight = 0;
+    uint8_t firstError = ERROR_NO_ERROR;
     while(wordsReceived < wordCount) {
-        this->writeByte(COMMAND_READ_WORD_SEQUENCE);
+        while (firstError == ERROR_NO_ERROR && requestsInFlight < maxRequestsInFlight && wordsRequested < wordCount) {
+            size_t wordsToRead = std::min((size_t)256, wordCount - wordsRequested);
+            this->writeRequest(COMMAND_READ_WORD_SEQUENCE, address + wordsRequested*4);
+            this->writeByte(wordsToRead - 1);
+            wordsRequested += wordsToRead;
+            requestsInFlight++;
+        }
+        if (requestsInFlight == 0) {
+            break;
+        }
         this->checkReturnValue();
-        uint32_t tmpAddr = address + wordsReceived*4;
-        this->writeWord(tmpAddr);
         size_t wordsToRead = std::min((size_t)256, wordCount - wordsReceived);
-        uint8_t sequenceSizeMinusOne = wordsToRead - 1;
-        this->writeByte(sequenceSizeMinusOne);
-        for (size_t i = wordsReceived; i < wordsReceived + wordsToRead; ++i) {
-            returnList[i] = this->readWord();
+        this->readArray(buf.data(), wordsToRead*4);
+        for (size_t i = 0; i < wordsToRead; ++i) {
+            returnList[wordsReceived + i] = decodeWord(&buf[i*4]);
         }
-        this->checkReturnValue();
+        this->collectReturnValue(firstError);
         wordsReceived += wordsToRead;
+        requestsInFlight--;
+    }
+    throwOnReturnValue(firstError);
+    return returnList;
+}
+
+void DeppUartMaster::writeWordRepeated(uint32_t address, const std::vector<uint32_t>& data) {
+    // A write request is 9 bytes. The bus master consumes the bytes of the current request as they arrive, so only the
+    // next one has to fit in its 16 byte input queue. Errors are reported once all requests in flight are answered, as
+    // in readWordSequence.
+    static constexpr size_t maxRequestsInFlight = 2;
+    size_t wordsSent = 0;
+    size_t wordsDone = 0;
+    uint8_t firstError = ERROR_NO_ERROR;
+    while (wordsDone < data.size()) {
+        while (firstError == ERROR_NO_ERROR && wordsSent - wordsDone < maxRequestsInFlight && wordsSent < data.size()) {
+            this->writeRequest(COMMAND_WRITE_WORD, address);
+            this->writeWord(data[wordsSent]);
+            wordsSent++;
+        }
+        if (wordsSent == wordsDone) {
+            break;
+        }
+        this->checkReturnValue();
+        this->collectReturnValue(firstError);
+        wordsDone++;
+    }
+    throwOnReturnValue(firstError);
+}
+
+std::vector<uint32_t> DeppUartMaster::readWordRepeated(uint32_t address, size_t count) {
+    // A read request is 5 bytes, so three of them fit in the 16 byte input queue of the bus master. Errors are reported
+    // once all requests in flight are answered, as in readWordSequence.
+    static constexpr size_t maxRequestsInFlight = 3;
+    std::vector<uint32_t> returnList(count);
+    size_t wordsRequested = 0;
+    size_t wordsReceived = 0;
+    uint8_t firstError = ERROR_NO_ERROR;
+    while (wordsReceived < count) {
+        while (firstError == ERROR_NO_ERROR && wordsRequested - wordsReceived < maxRequestsInFlight &&
+               wordsRequested < count) {
+            this->writeRequest(COMMAND_READ_WORD, address);
+            wordsRequested++;
+        }
+        if (wordsRequested == wordsReceived) {
+            break;
+        }
+        this->checkReturnValue();
+        returnList[wordsReceived] = this->readWord();
+        this->collectReturnValue(firstError);
+        wordsReceived++;
     }
+    throwOnReturnValue(firstError);
     return returnList;
 }
 
@@ -1,66 +1,201 @@
+#include <algorithm>
+#include <chrono>
 #include <iostream>
 #include <cassert>
 #include <fstream>
 #include <iterator>
+#include <sstream>
+#include <stdexcept>
 #include <vector>
 #include <unistd.h>
 #include <cstring>
 
+#include "console.hpp"
 #include "deppUartMaster.hpp"
 #include "inputFile.hpp"
+#include "memoryDiff.hpp"
+#include "memoryImage.hpp"
+#include "systemControl.hpp"
+#include "testHarness.hpp"
+#include "testReport.hpp"
 
-static constexpr uint32_t spiMemStartAddress = 0x100000;
-static constexpr uint32_t spiMemLength = 0x60000;
-static constexpr uint32_t cpuBaseAddress = 0x2000;
+static void printUsage(const char* progName) {
+    std::cout << "Usage: " << progName << " [-d device] <file path>" << std::endl;
+    std::cout << "       " << progName << " [-d device] -b <manifest> [-o <report.xml|report.json>]" << std::endl;
+    std::cout << "       " << progName << " [-d device] -s <snapshot>" << std::endl;
+    std::cout << "       " << progName << " [-d device] -c" << std::endl;
+    std::cout << "       " << progName << " [-d device] [-e <elf>] -D <expected> [<actual>]" << std::endl;
+    std::cout << "Snapshots cover the SPI memory. Diff inputs are snapshots or ELF files, a missing <actual> is captured from the device." << std::endl;
+}
 
-static void writeFile(DeppUartMaster& master, const std::string& filePath, uint32_t startAddress) {
-    std::vector<uint32_t> data = readFromFile(filePath);
-    master.writeWordSequence(startAddress, data);
+static int upload(DeppUartMaster& master, const std::string& path) {
+    std::cout << "Stop the CPU" << std::endl;
+    stopProcessor(master);
+    std::vector<uint32_t> data = readFromFile(path);
+    std::cout << "Write" << std::endl;
+    writeImage(master, data, spiMemStartAddress);
+    std::cout << "Verify" << std::endl;
+    bool success = verifyImage(master, data, spiMemStartAddress);
+    if (!success) {
+        std::cout << "Not starting the CPU due to verification errors" << std::endl;
+        return EXIT_FAILURE;
+    }
+    std::cout << "Start the CPU" << std::endl;
+    startProcessor(master);
+    return EXIT_SUCCESS;
 }
 
-static bool verifyWrite(DeppUartMaster& master, const std::string& filePath, uint32_t startAddress) {
-    std::vector<uint32_t> data = readFromFile(filePath);
-    uint32_t currentAddress = startAddress;
-    bool success = true;
-    std::vector<uint32_t> dataFromDevice = master.readWordSequence(startAddress, data.size());
-    for (size_t i = 0; i < data.size(); ++i) {
-        if (data[i] != dataFromDevice[i]) {
-            std::cout << std::hex << "Validation failed at address " << currentAddress << " expected data " << data[i] << " received data " << dataFromDevice[i] << std::dec << std::endl;
-            success = false;
+static int batch(DeppUartMaster& master, const std::string& manifestPath, const std::string& reportPath) {
+    std::vector<HarnessTest> tests = readManifest(manifestPath);
+    // Opened up front, so that an unwritable report path fails before the tests take their time
+    std::ofstream report;
+    if (!reportPath.empty()) {
+        report.open(reportPath);
+        if (!report) {
+            std::stringstream ss;
+            ss << "Failed to open report " << reportPath << " for writing";
+            throw std::invalid_argument(ss.str());
         }
-        currentAddress += 4;
     }
-    return success;
+    std::vector<HarnessResult> results = runHarness(master, tests);
+    if (!reportPath.empty()) {
+        if (reportPath.ends_with(".json")) {
+            writeJsonReport(report, results);
+        } else {
+            writeJUnitReport(report, results);
+        }
+        report.flush();
+        if (!report) {
+            std::stringstream ss;
+            ss << "Failed to write report " << reportPath;
+            throw std::runtime_error(ss.str());
+        }
+    }
+    size_t passed = std::count_if(results.begin(), results.end(), [](const HarnessResult& r) { return r.outcome == HarnessOutcome::pass; });
+    std::cout << passed << "/" << results.size() << " tests passed" << std::endl;
+    return passed == results.size() ? EXIT_SUCCESS : EXIT_FAILURE;
 }
 
-static void startProcessor(DeppUartMaster& master) {
-    master.writeWord(cpuBaseAddress, 0x0);
+static MemoryImage loadImage(const std::string& path) {
+    if (isSnapshot(path)) {
+        return readSnapshot(path);
+    }
+    return readElfImage(path, spiMemStartAddress, spiMemLength/4);
 }
 
-static void stopProcessor(DeppUartMaster& master) {
-    master.writeWord(cpuBaseAddress, 0x1);
+static MemoryImage captureSpiMem(DeppUartMaster& master) {
+    auto startTime = std::chrono::steady_clock::now();
+    MemoryImage image = captureImage(master, spiMemStartAddress, spiMemLength/4);
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - startTime).count();
+    std::cout << "Captured " << spiMemLength/1024 << " KiB in " << seconds << " s (" << spiMemLength/seconds/1024 << " KiB/s)" << std::endl;
+    return image;
 }
 
-int main(int argc, char* argv[]) {
-    DeppUartMaster master;
-    master.selfTest();
-    std::cout << "Bus selftest completed OK" << std::endl;
-    if (argc < 2) {
+static int diff(DeppUartMaster* master, const std::string& expectedPath, const std::string& actualPath, std::string elfPath) {
+    MemoryImage expected = loadImage(expectedPath);
+    MemoryImage actual = master != nullptr ? captureSpiMem(*master) : loadImage(actualPath);
+    if (elfPath.empty() && !isSnapshot(expectedPath)) {
+        elfPath = expectedPath;
+    } else if (elfPath.empty() && !actualPath.empty() && !isSnapshot(actualPath)) {
+        elfPath = actualPath;
+    }
+    std::vector<MemorySymbol> symbols;
+    if (!elfPath.empty()) {
+        symbols = readElfSymbols(elfPath);
+    }
+    std::vector<MemoryDiffRegion> regions = diffImages(expected, actual);
+    printDiff(std::cout, regions, symbols);
+    std::cout << regions.size() << " differing regions" << std::endl;
+    return regions.empty() ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+static int run(int argc, char* argv[]) {
+    std::string devName = "/dev/ttyUSB1";
+    std::string manifestPath;
+    std::string reportPath;
+    std::string snapshotPath;
+    std::string elfPath;
+    bool diffMode = false;
+    bool consoleMode = false;
+    int opt;
+    while ((opt = getopt(argc, argv, "d:b:o:s:e:Dc")) != -1) {
+        switch (opt) {
+            case 'd':
+                devName = optarg;
+                break;
+            case 'b':
+                manifestPath = optarg;
+                break;
+            case 'o':
+                reportPath = optarg;
+                break;
+            case 's':
+                snapshotPath = optarg;
+                break;
+            case 'e':
+                elfPath = optarg;
+                break;
+            case 'D':
+                diffMode = true;
+                break;
+            case 'c':
+                consoleMode = true;
+                break;
+            default:
+                printUsage(argv[0]);
+                return EXIT_FAILURE;
+        }
+    }
+    int modeCount = diffMode + consoleMode + !manifestPath.empty() + !snapshotPath.empty();
+    int argumentCount = argc - optind;
+    if (modeCount > 1) {
+        std::cout << "Only one of -b, -s, -c and -D can be given" << std::endl;
+        printUsage(argv[0]);
+        return EXIT_FAILURE;
+    }
+    if (diffMode && argumentCount != 1 && argumentCount != 2) {
+        std::cout << "Expected 1 or 2 arguments: the expected and the actual image" << std::endl;
+        printUsage(argv[0]);
+        return EXIT_FAILURE;
+    }
+    if (!diffMode && modeCount == 1 && argumentCount != 0) {
+        std::cout << "Unexpected argument: " << argv[optind] << std::endl;
+        printUsage(argv[0]);
+        return EXIT_FAILURE;
+    }
+    if (modeCount == 0 && argumentCount != 1) {
         std::cout << "Expected 1 argument: the file path" << std::endl;
+        printUsage(argv[0]);
         return EXIT_FAILURE;
     }
-    std::string path(argv[1]);
-    std::cout << "Stop the CPU" << std::endl;
-    stopProcessor(master);
-    std::cout << "Write" << std::endl;
-    writeFile(master, path, spiMemStartAddress);
-    std::cout << "Verify" << std::endl;
-    bool success = verifyWrite(master, path, spiMemStartAddress);
-    if (!success) {
-        std::cout << "Not starting the CPU due to verification errors" << std::endl;
+    if (diffMode && argumentCount == 2) {
+        return diff(nullptr, argv[optind], argv[optind + 1], elfPath);
+    }
+    DeppUartMaster master(devName);
+    master.selfTest();
+    std::cout << "Bus selftest completed OK" << std::endl;
+    if (diffMode) {
+        return diff(&master, argv[optind], "", elfPath);
+    }
+    if (consoleMode) {
+        return runConsole(master);
+    }
+    if (!manifestPath.empty()) {
+        return batch(master, manifestPath, reportPath);
+    }
+    if (!snapshotPath.empty()) {
+        writeSnapshot(snapshotPath, captureSpiMem(master));
+        return EXIT_SUCCESS;
+    }
+    return upload(master, argv[optind]);
+}
+
+int main(int argc, char* argv[]) {
+    // Catching here unwinds the stack, so the console restores the terminal and the tunnel on a failing link
+    try {
+        return run(argc, argv);
+    } catch (const std::exception& e) {
+        std::cerr << "Error: " << e.what() << std::endl;
         return EXIT_FAILURE;
     }
-    std::cout << "Start the CPU" << std::endl;
-    startProcessor(master);
-    return EXIT_SUCCESS;
 }
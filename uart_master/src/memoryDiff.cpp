@@ -0,0 +1,68 @@
+#include <algorithm>
+#include <cstring>
+#include <iomanip>
+
+#include "memoryDiff.hpp"
+
+std::vector<MemoryDiffRegion> diffImages(const MemoryImage& expected, const MemoryImage& actual) {
+    // Most of the memory is usually unchanged, so whole blocks are compared with memcmp first, which is vectorized,
+    // and only blocks that differ are walked word by word.
+    static constexpr size_t blockWords = 256;
+    std::vector<MemoryDiffRegion> regions;
+    uint32_t first = std::max(expected.baseAddress, actual.baseAddress);
+    uint32_t last = std::min<size_t>(expected.baseAddress + expected.words.size()*4, actual.baseAddress + actual.words.size()*4);
+    if (first >= last) {
+        return regions;
+    }
+    const uint32_t* expectedWords = &expected.words[(first - expected.baseAddress)/4];
+    const uint32_t* actualWords = &actual.words[(first - actual.baseAddress)/4];
+    const uint8_t* expectedValid = &expected.valid[(first - expected.baseAddress)/4];
+    const uint8_t* actualValid = &actual.valid[(first - actual.baseAddress)/4];
+    size_t wordCount = (last - first)/4;
+    bool inRegion = false;
+    for (size_t block = 0; block < wordCount; block += blockWords) {
+        size_t count = std::min(blockWords, wordCount - block);
+        if (memcmp(&expectedWords[block], &actualWords[block], count*sizeof(uint32_t)) == 0) {
+            inRegion = false;
+            continue;
+        }
+        for (size_t i = block; i < block + count; ++i) {
+            bool differs = expectedValid[i] && actualValid[i] && expectedWords[i] != actualWords[i];
+            if (!differs) {
+                inRegion = false;
+            } else if (inRegion) {
+                regions.back().wordCount++;
+            } else {
+                regions.push_back({static_cast<uint32_t>(first + i*4), 1, expectedWords[i], actualWords[i]});
+                inRegion = true;
+            }
+        }
+    }
+    return regions;
+}
+
+static const MemorySymbol* findSymbol(const std::vector<MemorySymbol>& symbols, uint32_t address) {
+    auto it = std::upper_bound(symbols.begin(), symbols.end(), address, [](uint32_t addr, const MemorySymbol& symbol) { return addr < symbol.address; });
+    if (it == symbols.begin()) {
+        return nullptr;
+    }
+    --it;
+    if (it->size != 0 && address >= it->address + it->size) {
+        return nullptr;
+    }
+    return &*it;
+}
+
+void printDiff(std::ostream& os, const std::vector<MemoryDiffRegion>& regions, const std::vector<MemorySymbol>& symbols) {
+    for (const MemoryDiffRegion& region : regions) {
+        os << std::hex << std::setfill('0');
+        os << "0x" << std::setw(8) << region.address << " - 0x" << std::setw(8) << region.address + region.wordCount*4 - 1;
+        os << std::dec << " (" << region.wordCount << " words)";
+        const MemorySymbol* symbol = findSymbol(symbols, region.address);
+        if (symbol != nullptr) {
+            os << " " << symbol->name << "+0x" << std::hex << region.address - symbol->address;
+        }
+        os << std::hex << ": expected 0x" << std::setw(8) << region.firstExpected << " got 0x" << std::setw(8) << region.firstActual;
+        os << std::dec << std::setfill(' ') << std::endl;
+    }
+}
@@ -0,0 +1,188 @@
+#include <algorithm>
+#include <cstring>
+#include <elf.h>
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+
+#include "memoryImage.hpp"
+
+// Snapshot layout, all fields little endian 32 bit:
+//   magic, base address, word count, words per page, stored page count
+//   per stored page: page index, followed by the words of that page
+// Pages that only contain zeroes are not stored.
+static constexpr uint32_t snapshotMagic = 0x50414e53; // "SNAP"
+static constexpr uint32_t snapshotPageWords = 256;
+
+MemoryImage captureImage(DeppUartMaster& master, uint32_t address, size_t wordCount) {
+    MemoryImage image;
+    image.baseAddress = address;
+    image.words = master.readWordSequence(address, wordCount);
+    image.valid.assign(wordCount, 1);
+    return image;
+}
+
+static void writeU32(std::ofstream& stream, uint32_t value) {
+    char buf[4];
+    for (size_t i = 0; i < 4; ++i) {
+        buf[i] = static_cast<char>(value & 0xff);
+        value >>= 8;
+    }
+    stream.write(buf, sizeof(buf));
+}
+
+static uint32_t readU32(std::ifstream& stream) {
+    uint8_t buf[4] = {};
+    stream.read(reinterpret_cast<char*>(buf), sizeof(buf));
+    return buf[0] | (static_cast<uint32_t>(buf[1]) << 8) | (static_cast<uint32_t>(buf[2]) << 16) |
+        (static_cast<uint32_t>(buf[3]) << 24);
+}
+
+void writeSnapshot(const std::string& filename, const MemoryImage& image) {
+    std::ofstream stream(filename, std::ios::binary);
+    if (!stream) {
+        std::stringstream ss;
+        ss << "Failed to open snapshot " << filename << " for writing";
+        throw std::invalid_argument(ss.str());
+    }
+    size_t pageCount = (image.words.size() + snapshotPageWords - 1)/snapshotPageWords;
+    std::vector<uint32_t> storedPages;
+    for (size_t page = 0; page < pageCount; ++page) {
+        auto first = image.words.begin() + page*snapshotPageWords;
+        auto last = image.words.begin() + std::min(image.words.size(), (page + 1)*snapshotPageWords);
+        if (std::any_of(first, last, [](uint32_t word) { return word != 0; })) {
+            storedPages.push_back(page);
+        }
+    }
+    writeU32(stream, snapshotMagic);
+    writeU32(stream, image.baseAddress);
+    writeU32(stream, image.words.size());
+    writeU32(stream, snapshotPageWords);
+    writeU32(stream, storedPages.size());
+    for (uint32_t page : storedPages) {
+        size_t first = page*snapshotPageWords;
+        size_t count = std::min(image.words.size() - first, (size_t)snapshotPageWords);
+        writeU32(stream, page);
+        for (size_t i = first; i < first + count; ++i) {
+            writeU32(stream, image.words[i]);
+        }
+    }
+    if (!stream) {
+        std::stringstream ss;
+        ss << "Failed to write snapshot " << filename;
+        throw std::runtime_error(ss.str());
+    }
+}
+
+MemoryImage readSnapshot(const std::string& filename) {
+    std::ifstream stream(filename, std::ios::binary);
+    if (!stream || readU32(stream) != snapshotMagic) {
+        std::stringstream ss;
+        ss << filename << " is not a snapshot";
+        throw std::invalid_argument(ss.str());
+    }
+    MemoryImage image;
+    image.baseAddress = readU32(stream);
+    uint32_t wordCount = readU32(stream);
+    uint32_t pageWords = readU32(stream);
+    uint32_t storedPages = readU32(stream);
+    image.words.assign(wordCount, 0);
+    image.valid.assign(wordCount, 1);
+    for (uint32_t i = 0; i < storedPages && stream; ++i) {
+        size_t first = static_cast<size_t>(readU32(stream))*pageWords;
+        if (first >= wordCount) {
+            break;
+        }
+        size_t count = std::min(wordCount - first, (size_t)pageWords);
+        for (size_t word = first; word < first + count; ++word) {
+            image.words[word] = readU32(stream);
+        }
+    }
+    if (!stream) {
+        std::stringstream ss;
+        ss << "Snapshot " << filename << " is truncated";
+        throw std::runtime_error(ss.str());
+    }
+    return image;
+}
+
+bool isSnapshot(const std::string& filename) {
+    std::ifstream stream(filename, std::ios::binary);
+    return stream && readU32(stream) == snapshotMagic;
+}
+
+static std::vector<uint8_t> readElfFile(const std::string& filename) {
+    std::ifstream stream(filename, std::ios::binary);
+    std::vector<uint8_t> data((std::istreambuf_iterator<char>(stream)), std::istreambuf_iterator<char>());
+    if (data.size() < sizeof(Elf32_Ehdr) || memcmp(data.data(), ELFMAG, SELFMAG) != 0 ||
+            data[EI_CLASS] != ELFCLASS32 || data[EI_DATA] != ELFDATA2LSB) {
+        std::stringstream ss;
+        ss << filename << " is not a 32 bit little endian ELF file";
+        throw std::invalid_argument(ss.str());
+    }
+    return data;
+}
+
+template<typename T>
+static const T& elfEntry(const std::vector<uint8_t>& data, size_t offset, const std::string& filename) {
+    if (offset + sizeof(T) > data.size()) {
+        std::stringstream ss;
+        ss << filename << " is truncated";
+        throw std::runtime_error(ss.str());
+    }
+    return *reinterpret_cast<const T*>(&data[offset]);
+}
+
+MemoryImage readElfImage(const std::string& filename, uint32_t baseAddress, size_t wordCount) {
+    std::vector<uint8_t> data = readElfFile(filename);
+    const Elf32_Ehdr& header = elfEntry<Elf32_Ehdr>(data, 0, filename);
+    MemoryImage image;
+    image.baseAddress = baseAddress;
+    image.words.assign(wordCount, 0);
+    image.valid.assign(wordCount, 0);
+    uint32_t endAddress = baseAddress + wordCount*4;
+    for (size_t i = 0; i < header.e_phnum; ++i) {
+        const Elf32_Phdr& segment = elfEntry<Elf32_Phdr>(data, header.e_phoff + i*header.e_phentsize, filename);
+        if (segment.p_type != PT_LOAD || segment.p_filesz == 0 || segment.p_offset + segment.p_filesz > data.size()) {
+            continue;
+        }
+        for (uint32_t byte = 0; byte < segment.p_filesz; ++byte) {
+            uint32_t address = segment.p_paddr + byte;
+            if (address < baseAddress || address >= endAddress) {
+                continue;
+            }
+            size_t index = (address - baseAddress)/4;
+            size_t shift = (address % 4)*8;
+            image.words[index] |= static_cast<uint32_t>(data[segment.p_offset + byte]) << shift;
+            image.valid[index] = 1;
+        }
+    }
+    return image;
+}
+
+std::vector<MemorySymbol> readElfSymbols(const std::string& filename) {
+    std::vector<uint8_t> data = readElfFile(filename);
+    const Elf32_Ehdr& header = elfEntry<Elf32_Ehdr>(data, 0, filename);
+    std::vector<MemorySymbol> symbols;
+    for (size_t i = 0; i < header.e_shnum; ++i) {
+        const Elf32_Shdr& section = elfEntry<Elf32_Shdr>(data, header.e_shoff + i*header.e_shentsize, filename);
+        if (section.sh_type != SHT_SYMTAB) {
+            continue;
+        }
+        const Elf32_Shdr& strtab = elfEntry<Elf32_Shdr>(data, header.e_shoff + section.sh_link*header.e_shentsize, filename);
+        if (strtab.sh_offset + strtab.sh_size > data.size()) {
+            continue;
+        }
+        for (size_t offset = 0; offset + sizeof(Elf32_Sym) <= section.sh_size; offset += sizeof(Elf32_Sym)) {
+            const Elf32_Sym& symbol = elfEntry<Elf32_Sym>(data, section.sh_offset + offset, filename);
+            unsigned char type = ELF32_ST_TYPE(symbol.st_info);
+            if ((type != STT_FUNC && type != STT_OBJECT) || symbol.st_name >= strtab.sh_size) {
+                continue;
+            }
+            const char* name = reinterpret_cast<const char*>(&data[strtab.sh_offset + symbol.st_name]);
+            symbols.push_back({symbol.st_value, symbol.st_size, std::string(name, strnlen(name, strtab.sh_size - symbol.st_name))});
+        }
+    }
+    std::sort(symbols.begin(), symbols.end(), [](const MemorySymbol& a, const MemorySymbol& b) { return a.address < b.address; });
+    return symbols;
+}
@@ -0,0 +1,29 @@
+#include <iostream>
+
+#include "systemControl.hpp"
+
+void writeImage(DeppUartMaster& master, const std::vector<uint32_t>& data, uint32_t startAddress) {
+    master.writeWordSequence(startAddress, data);
+}
+
+bool verifyImage(DeppUartMaster& master, const std::vector<uint32_t>& data, uint32_t startAddress) {
+    uint32_t currentAddress = startAddress;
+    bool success = true;
+    std::vector<uint32_t> dataFromDevice = master.readWordSequence(startAddress, data.size());
+    for (size_t i = 0; i < data.size(); ++i) {
+        if (data[i] != dataFromDevice[i]) {
+            std::cout << std::hex << "Validation failed at address " << currentAddress << " expected data " << data[i] << " received data " << dataFromDevice[i] << std::dec << std::endl;
+            success = false;
+        }
+        currentAddress += 4;
+    }
+    return success;
+}
+
+void startProcessor(DeppUartMaster& master) {
+    master.writeWord(cpuBaseAddress, 0x0);
+}
+
+void stopProcessor(DeppUartMaster& master) {
+    master.writeWord(cpuBaseAddress, 0x1);
+}
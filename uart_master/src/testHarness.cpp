@@ -0,0 +1,160 @@
+#include <chrono>
+#include <cstdint>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+
+#include "inputFile.hpp"
+#include "systemControl.hpp"
+#include "testHarness.hpp"
+
+static uint32_t parseNumber(const std::string& token, size_t lineNumber) {
+    size_t pos = 0;
+    unsigned long value = 0;
+    try {
+        value = std::stoul(token, &pos, 0);
+    } catch (const std::logic_error&) {
+        pos = 0;
+    }
+    if (pos != token.size() || value > UINT32_MAX) {
+        std::stringstream ss;
+        ss << "Manifest line " << lineNumber << ": invalid number " << token;
+        throw std::invalid_argument(ss.str());
+    }
+    return static_cast<uint32_t>(value);
+}
+
+static void checkTestComplete(const HarnessTest& test) {
+    if (test.mailboxWordCount == 0) {
+        std::stringstream ss;
+        ss << "Manifest: test " << test.name << " has no mailbox";
+        throw std::invalid_argument(ss.str());
+    }
+}
+
+std::vector<HarnessTest> readManifest(const std::string& filename) {
+    std::ifstream stream(filename);
+    if (!stream) {
+        std::stringstream ss;
+        ss << "Failed to open manifest " << filename;
+        throw std::invalid_argument(ss.str());
+    }
+    std::vector<HarnessTest> tests;
+    std::string line;
+    size_t lineNumber = 0;
+    while (std::getline(stream, line)) {
+        lineNumber++;
+        std::istringstream lineStream(line);
+        std::string keyword;
+        if (!(lineStream >> keyword) || keyword[0] == '#') {
+            continue;
+        }
+        std::vector<std::string> args;
+        std::string arg;
+        while (lineStream >> arg) {
+            args.push_back(arg);
+        }
+        if (keyword == "test" && args.size() == 3) {
+            if (!tests.empty()) {
+                checkTestComplete(tests.back());
+            }
+            tests.push_back({args[0], args[1], parseNumber(args[2], lineNumber), 0, 0, {}});
+        } else if (keyword == "mailbox" && args.size() == 2 && !tests.empty()) {
+            tests.back().mailboxAddress = parseNumber(args[0], lineNumber);
+            tests.back().mailboxWordCount = parseNumber(args[1], lineNumber);
+        } else if (keyword == "expect" && args.size() >= 2 && !tests.empty()) {
+            HarnessExpectation expectation;
+            expectation.address = parseNumber(args[0], lineNumber);
+            for (size_t i = 1; i < args.size(); ++i) {
+                expectation.data.push_back(parseNumber(args[i], lineNumber));
+            }
+            tests.back().expectations.push_back(expectation);
+        } else {
+            std::stringstream ss;
+            ss << "Manifest line " << lineNumber << ": cannot parse '" << line << "'";
+            throw std::invalid_argument(ss.str());
+        }
+    }
+    if (!tests.empty()) {
+        checkTestComplete(tests.back());
+    }
+    return tests;
+}
+
+static bool checkExpectations(DeppUartMaster& master, const HarnessTest& test, const std::vector<uint32_t>& mailbox, std::string& message) {
+    uint32_t mailboxEnd = test.mailboxAddress + mailbox.size()*4;
+    for (const HarnessExpectation& expectation : test.expectations) {
+        uint32_t expectationEnd = expectation.address + expectation.data.size()*4;
+        std::vector<uint32_t> actual;
+        if (expectation.address >= test.mailboxAddress && expectationEnd <= mailboxEnd) {
+            auto first = mailbox.begin() + (expectation.address - test.mailboxAddress)/4;
+            actual.assign(first, first + expectation.data.size());
+        } else {
+            actual = master.readWordSequence(expectation.address, expectation.data.size());
+        }
+        for (size_t i = 0; i < expectation.data.size(); ++i) {
+            if (actual[i] != expectation.data[i]) {
+                std::stringstream ss;
+                ss << std::hex << "At address 0x" << expectation.address + i*4 << " expected 0x" << expectation.data[i] << " received 0x" << actual[i];
+                message = ss.str();
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+static HarnessResult runTest(DeppUartMaster& master, const HarnessTest& test) {
+    HarnessResult result = {test.name, HarnessOutcome::pass, "", 0.0};
+    auto startTime = std::chrono::steady_clock::now();
+    try {
+        std::vector<uint32_t> image = readFromFile(test.imagePath);
+        stopProcessor(master);
+        writeImage(master, image, spiMemStartAddress);
+        if (!verifyImage(master, image, spiMemStartAddress)) {
+            result.outcome = HarnessOutcome::error;
+            result.message = "Image verification failed";
+        } else {
+            master.writeWordSequence(test.mailboxAddress, std::vector<uint32_t>(test.mailboxWordCount, 0));
+            startProcessor(master);
+            auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(test.timeoutMs);
+            std::vector<uint32_t> mailbox;
+            bool finished = false;
+            while (!finished) {
+                mailbox = master.readWordSequence(test.mailboxAddress, test.mailboxWordCount);
+                finished = mailbox[0] != 0;
+                if (std::chrono::steady_clock::now() >= deadline) {
+                    break;
+                }
+            }
+            stopProcessor(master);
+            if (!finished) {
+                result.outcome = HarnessOutcome::timeout;
+                result.message = "Mailbox not written within timeout";
+            } else if (!checkExpectations(master, test, mailbox, result.message)) {
+                result.outcome = HarnessOutcome::fail;
+            }
+        }
+    } catch (const std::exception& e) {
+        result.outcome = HarnessOutcome::error;
+        result.message = e.what();
+    }
+    result.durationSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - startTime).count();
+    return result;
+}
+
+std::vector<HarnessResult> runHarness(DeppUartMaster& master, const std::vector<HarnessTest>& tests) {
+    static const char* const outcomeNames[] = {"PASS", "FAIL", "TIMEOUT", "ERROR"};
+    std::vector<HarnessResult> results;
+    for (const HarnessTest& test : tests) {
+        HarnessResult result = runTest(master, test);
+        std::cout << "[" << outcomeNames[static_cast<int>(result.outcome)] << "] " << result.name << " (" << result.durationSeconds << " s)";
+        if (!result.message.empty()) {
+            std::cout << ": " << result.message;
+        }
+        std::cout << std::endl;
+        results.push_back(result);
+    }
+    return results;
+}
@@ -0,0 +1,85 @@
+#include <cstdio>
+#include <string>
+
+#include "testReport.hpp"
+
+static std::string xmlEscape(const std::string& in) {
+    std::string out;
+    for (char c : in) {
+        switch (c) {
+            case '&': out += "&amp;"; break;
+            case '<': out += "&lt;"; break;
+            case '>': out += "&gt;"; break;
+            case '"': out += "&quot;"; break;
+            case '\'': out += "&apos;"; break;
+            default: out += c; break;
+        }
+    }
+    return out;
+}
+
+static std::string jsonEscape(const std::string& in) {
+    std::string out;
+    for (char c : in) {
+        if (c == '"' || c == '\\') {
+            out += '\\';
+            out += c;
+        } else if (static_cast<unsigned char>(c) < 0x20) {
+            char buf[8];
+            snprintf(buf, sizeof(buf), "\\u%04x", c);
+            out += buf;
+        } else {
+            out += c;
+        }
+    }
+    return out;
+}
+
+static const char* outcomeName(HarnessOutcome outcome) {
+    switch (outcome) {
+        case HarnessOutcome::pass: return "pass";
+        case HarnessOutcome::fail: return "fail";
+        case HarnessOutcome::timeout: return "timeout";
+        case HarnessOutcome::error: return "error";
+    }
+    return "unknown";
+}
+
+void writeJUnitReport(std::ostream& os, const std::vector<HarnessResult>& results) {
+    size_t failures = 0;
+    size_t errors = 0;
+    double totalTime = 0.0;
+    for (const HarnessResult& result : results) {
+        if (result.outcome == HarnessOutcome::fail || result.outcome == HarnessOutcome::timeout) {
+            failures++;
+        } else if (result.outcome == HarnessOutcome::error) {
+            errors++;
+        }
+        totalTime += result.durationSeconds;
+    }
+    os << "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n";
+    os << "<testsuite name=\"uart_master\" tests=\"" << results.size() << "\" failures=\"" << failures << "\" errors=\"" << errors << "\" time=\"" << totalTime << "\">\n";
+    for (const HarnessResult& result : results) {
+        os << "  <testcase name=\"" << xmlEscape(result.name) << "\" time=\"" << result.durationSeconds << "\"";
+        if (result.outcome == HarnessOutcome::pass) {
+            os << "/>\n";
+            continue;
+        }
+        os << ">\n";
+        const char* element = result.outcome == HarnessOutcome::error ? "error" : "failure";
+        os << "    <" << element << " type=\"" << outcomeName(result.outcome) << "\" message=\"" << xmlEscape(result.message) << "\"/>\n";
+        os << "  </testcase>\n";
+    }
+    os << "</testsuite>\n";
+}
+
+void writeJsonReport(std::ostream& os, const std::vector<HarnessResult>& results) {
+    os << "[\n";
+    for (size_t i = 0; i < results.size(); ++i) {
+        const HarnessResult& result = results[i];
+        os << "  {\"name\": \"" << jsonEscape(result.name) << "\", \"outcome\": \"" << outcomeName(result.outcome)
+           << "\", \"message\": \"" << jsonEscape(result.message) << "\", \"time\": " << result.durationSeconds << "}";
+        os << (i + 1 < results.size() ? ",\n" : "\n");
+    }
+    os << "]\n";
+}